@@ -0,0 +1,39 @@
+#pragma once
+// Alpha blending of RGB565 spans with an 8-bit or 4-bit alpha, for overlays drawn into
+// tile strips (warning banners, translucent popups, anti-aliased text and icons).
+//
+// Every channel is blended at its own width and rounded to nearest:
+//   out = (fg * a + bg * (255 - a) + 127) / 255        a = 0 (keep bg) .. 255 (fg)
+// A 4-bit alpha n stands for n * 17. BLEND_Pixel and the BLEND_Ref* loops are the scalar
+// definition; the span functions compute the same result two pixels at a time with the
+// Cortex-M7 DSP instructions (one __SMLAD per channel and pixel) and match it bit for bit.
+// The host build runs the same code on C versions of the intrinsics, and ssd1963_bench
+// checks it against the reference.
+//
+// 4-bit masks hold two pixels per byte, the even pixel in the low nibble; first is the
+// index of the span's first pixel in the mask, so spans may start on an odd pixel.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint16_t BLEND_Pixel(uint16_t fg, uint16_t bg, uint8_t alpha);
+
+// One colour at one alpha (translucent fills) or through a coverage mask (text, shapes)
+void BLEND_Colour(uint16_t* dst, uint16_t rgb565, uint8_t alpha, uint32_t n);
+void BLEND_ColourA8(uint16_t* dst, uint16_t rgb565, const uint8_t* alpha, uint32_t n);
+
+// An RGB565 image with a separate alpha plane
+void BLEND_ImageA8(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint32_t n);
+void BLEND_ImageA4(uint16_t* dst, const uint16_t* src, const uint8_t* alpha4, uint32_t first, uint32_t n);
+
+// Scalar reference loops, one BLEND_Pixel per pixel
+void BLEND_RefColour(uint16_t* dst, uint16_t rgb565, uint8_t alpha, uint32_t n);
+void BLEND_RefColourA8(uint16_t* dst, uint16_t rgb565, const uint8_t* alpha, uint32_t n);
+void BLEND_RefImageA8(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint32_t n);
+void BLEND_RefImageA4(uint16_t* dst, const uint16_t* src, const uint8_t* alpha4, uint32_t first, uint32_t n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,87 @@
+#pragma once
+// Pixel operations on RGB565 buffers in RAM (tile strips, scratch images).
+//
+// Two backends with the same API, picked at build time with BLIT_BACKEND:
+//   BLIT_BACKEND_CPU    plain loops (blit2d_cpu.c), also what the host simulator uses
+//   BLIT_BACKEND_DMA2D  the Chrom-ART engine, programmed at register level
+//                       (blit2d_dma2d.c)
+//
+// DMA2D operations are asynchronous: a call returns once the transfer is started, and
+// the destination must not be read or written, nor a RAM source changed, before
+// BLIT_Wait. Every BLIT_ call waits for the previous one first, so a sequence of them
+// needs no waits in between. With the CPU backend BLIT_Wait returns at once.
+//
+// The CPU loops are always built as BLIT_Cpu* so the benchmark can compare them with
+// whichever backend is selected. Both expand RGB565 and ARGB4444 to 8 bits per channel
+// by bit replication, blend at 8 bits and truncate back to RGB565, so they agree to
+// within 1 LSB per channel (the DMA2D divide by 255 is not specified exactly).
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BLIT_BACKEND_CPU        0
+#define BLIT_BACKEND_DMA2D      1
+
+#ifndef BLIT_BACKEND
+#ifdef SSD1963_HOST_SIM
+#define BLIT_BACKEND BLIT_BACKEND_CPU
+#else
+#define BLIT_BACKEND BLIT_BACKEND_DMA2D
+#endif
+#endif
+
+#if BLIT_BACKEND == BLIT_BACKEND_DMA2D
+#ifdef SSD1963_HOST_SIM
+#error "The host simulator has no DMA2D model, build it with BLIT_BACKEND_CPU"
+#endif
+#define BLIT_BACKEND_NAME       "dma2d"
+#elif BLIT_BACKEND == BLIT_BACKEND_CPU
+#define BLIT_BACKEND_NAME       "cpu"
+#else
+#error "Unknown BLIT_BACKEND"
+#endif
+
+// Below this many pixels the DMA2D register setup and cache maintenance cost more than
+// the loop, so the DMA2D backend runs the CPU path instead
+#ifndef BLIT_DMA2D_MIN_PIXELS
+#define BLIT_DMA2D_MIN_PIXELS   64u
+#endif
+
+// All strides are in pixels of the buffer they belong to. w and h of 0 do nothing.
+void BLIT_Fill(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t rgb565);
+
+void BLIT_Copy(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+               uint16_t w, uint16_t h);
+
+// Blend a straight-alpha overlay onto dst
+void BLIT_BlendArgb8888(uint16_t* dst, uint16_t dst_stride, const uint32_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h);
+void BLIT_BlendArgb4444(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h);
+
+// Expand 8-bit indices through an ARGB8888 palette of clut_size (1..256) entries; the
+// alpha channel of the palette is ignored. src must not hold indices >= clut_size.
+void BLIT_ExpandL8(uint16_t* dst, uint16_t dst_stride, const uint8_t* src, uint16_t src_stride,
+                   uint16_t w, uint16_t h, const uint32_t* clut, uint16_t clut_size);
+
+// Wait for the last operation to finish writing dst
+void BLIT_Wait(void);
+
+// -----------------------------
+// CPU reference
+// -----------------------------
+void BLIT_CpuFill(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t rgb565);
+void BLIT_CpuCopy(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                  uint16_t w, uint16_t h);
+void BLIT_CpuBlendArgb8888(uint16_t* dst, uint16_t dst_stride, const uint32_t* src, uint16_t src_stride,
+                           uint16_t w, uint16_t h);
+void BLIT_CpuBlendArgb4444(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                           uint16_t w, uint16_t h);
+void BLIT_CpuExpandL8(uint16_t* dst, uint16_t dst_stride, const uint8_t* src, uint16_t src_stride,
+                      uint16_t w, uint16_t h, const uint32_t* clut, uint16_t clut_size);
+
+#ifdef __cplusplus
+}
+#endif
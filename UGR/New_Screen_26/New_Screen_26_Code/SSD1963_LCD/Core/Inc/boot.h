@@ -0,0 +1,53 @@
+#pragma once
+// Staged boot.
+//
+// The SSD1963 needs about 100 ms of reset, PLL lock and soft-reset waits before it takes
+// pixels. BOOT_PanelStart begins that sequence as soon as the FMC is configured
+// (MX_FMC_Init) and BOOT_Tick advances it from SysTick, so the remaining MX_*_Init calls
+// and the application's own bring-up run during the waits instead of after them.
+// BOOT_Splash then draws the first frame the moment the controller is configured and
+// only afterwards switches the display and backlight on, so the panel never shows
+// uninitialised frame memory.
+//
+// Every phase is timestamped from the DWT cycle counter, which BOOT_Start enables at the
+// top of main(). Each interval is converted at the HCLK that was running when it began;
+// only the CLOCK phase spans a clock switch, and its part after the switch is short.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    BOOT_PHASE_MAIN,            // main() entered, time zero
+    BOOT_PHASE_HAL,             // HAL_Init done
+    BOOT_PHASE_CLOCK,           // CLK_ApplyProfile done
+    BOOT_PHASE_PANEL_START,     // FMC up, panel reset asserted
+    BOOT_PHASE_PERIPHERALS,     // every MX_*_Init done
+    BOOT_PHASE_PANEL_READY,     // controller configured (marked from SysTick)
+    BOOT_PHASE_SPLASH,          // first frame drawn, display and backlight on
+    BOOT_PHASE_DASH,            // first dashboard frame, marked by the application
+    BOOT_PHASE_COUNT
+} BOOT_Phase;
+
+// Top of main(), before anything else: starts the cycle counter and marks BOOT_PHASE_MAIN
+void BOOT_Start(void);
+void BOOT_Mark(BOOT_Phase phase);
+
+// From MX_FMC_Init (USER CODE FMC_Init 2) and SysTick_Handler (USER CODE SysTick_IRQn 1)
+void BOOT_PanelStart(void);
+void BOOT_Tick(void);
+
+// Sleeps until the panel is configured, draws the splash and switches it on
+void BOOT_Splash(void);
+
+// Microseconds from BOOT_PHASE_MAIN to phase, 0 if it was not reached
+uint32_t BOOT_PhaseUs(BOOT_Phase phase);
+
+// Timeline over SWO
+void BOOT_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+// bxCAN acceptance-filter planner.
+//
+// Turns the set of identifiers the application subscribes to into filter bank settings
+// that accept exactly those data frames and nothing else, so the CPU never sees an
+// irrelevant frame. Each bank is one of
+//
+//   16-bit list   4 standard identifiers
+//   16-bit mask   2 standard identifier blocks
+//   32-bit list   2 identifiers, standard or extended
+//   32-bit mask   1 identifier block, standard or extended
+//
+// A block is a set of identifiers that agree on some bits and take every value on the
+// rest (0x120-0x127, or 0x100/0x140/0x180/0x1C0). The planner grows the largest block
+// around each identifier that stays inside the subscribed set and uses it wherever it
+// saves entries, lists the rest, then fills the partly used banks with leftovers.
+// Remote frames never match. Banks are spread over FIFO0 and FIFO1 so each carries about
+// the same traffic.
+//
+// Pure computation, no HAL: the host build checks plans with CANFLT_Match.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Filter banks of the F7's bxCAN pair; CAN2 gets all of them while CAN1 is unused
+#define CANFLT_BANKS        28u
+// Most identifiers one plan takes
+#define CANFLT_MAX_IDS      128u
+
+// Identifier keys: the identifier, with this bit set for 29-bit ones (as CANSIG_Message.key)
+#define CANFLT_EXT          0x80000000u
+
+typedef enum
+{
+    CANFLT_LIST16,
+    CANFLT_MASK16,
+    CANFLT_LIST32,
+    CANFLT_MASK32,
+} CANFLT_Mode;
+
+typedef struct
+{
+    uint32_t fr1;           // filter bank registers (CAN_FilterRegister FR1 / FR2)
+    uint32_t fr2;
+    uint32_t weight;        // traffic the bank accepts, for FIFO balancing
+    uint8_t  mode;          // CANFLT_Mode
+    uint8_t  fifo;          // 0 or 1
+    uint8_t  ids;           // subscribed identifiers it accepts
+} CANFLT_Bank;
+
+typedef struct
+{
+    CANFLT_Bank bank[CANFLT_BANKS];
+    uint32_t count;
+    uint32_t fifo_weight[2];
+} CANFLT_Plan;
+
+// Plans for n identifier keys. rates weighs each key's traffic for the FIFO balance
+// (frames per second, say); NULL counts every key the same. Returns the number of banks,
+// or 0 if the set does not fit (or n is 0 or above CANFLT_MAX_IDS).
+uint32_t CANFLT_Build(CANFLT_Plan* plan, const uint32_t* keys, uint32_t n, const uint16_t* rates);
+
+// Whether the planned banks pass a frame, as the hardware would decide; fifo is set to
+// where it would land. remote is nonzero for a remote (RTR) frame.
+uint8_t CANFLT_Match(const CANFLT_Plan* plan, uint32_t key, uint8_t remote, uint8_t* fifo);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,29 @@
+#pragma once
+// A received CAN frame as can_rx.c queues it. Kept apart from can_rx.h, which needs the
+// bxCAN HAL, so the decoder (can_signal.c) also builds on the host.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// CANRX_Frame.flags
+#define CANRX_EXT           0x01u   // 29-bit identifier
+#define CANRX_RTR           0x02u   // remote frame, no data
+#define CANRX_FIFO1         0x04u   // received through FIFO1
+
+typedef struct
+{
+    uint32_t id;            // 11-bit standard or 29-bit extended identifier
+    uint32_t cycles;        // DWT cycle counter at reception
+    uint32_t tick;          // HAL_GetTick() at reception, ms
+    uint8_t  dlc;
+    uint8_t  flags;         // CANRX_EXT | CANRX_RTR | CANRX_FIFO1
+    uint8_t  filter;        // filter match index (FMI) within its FIFO
+    uint8_t  reserved;
+    uint8_t  data[8];
+} CANRX_Frame;
+
+#ifdef __cplusplus
+}
+#endif
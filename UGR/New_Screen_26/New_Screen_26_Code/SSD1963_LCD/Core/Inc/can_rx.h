@@ -0,0 +1,53 @@
+#pragma once
+// CAN2 receive path.
+//
+// Both bxCAN receive FIFOs are drained from their interrupts (CAN2_RX0 / CAN2_RX1) into
+// one single-producer / single-consumer ring of timestamped frames; the main loop takes
+// them out in batches with CANRX_Peek / CANRX_Release. The hardware only buffers three
+// frames per FIFO, so the interrupts copy each frame out as soon as it arrives and the
+// ring absorbs however long the main loop spends rendering.
+//
+// The two receive interrupts are the only producer: they run at the same preemption
+// priority and so never interrupt each other (CANRX_Start checks this). The main loop is
+// the only consumer. The producer writes only the head index and the consumer only the
+// tail, so neither side ever masks interrupts.
+#include <stdint.h>
+#include "can.h"
+#include "can_frame.h"
+#include "can_filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frames the ring holds, a power of two. At 1 Mbit/s the ECU's 8-byte frames arrive about
+// every 111 us, so 512 covers more than 50 ms of full bus load (two full-screen redraws).
+#ifndef CANRX_RING_SIZE
+#define CANRX_RING_SIZE     512u
+#endif
+
+typedef struct
+{
+    uint32_t received;      // frames put into the ring
+    uint32_t ring_full;     // frames dropped because the main loop fell behind
+    uint32_t fifo_overrun;  // bxCAN FIFO overruns, at least one frame lost each
+    uint32_t peak;          // most frames ever waiting in the ring
+} CANRX_Stats;
+
+// Filters from plan (can_filter.h), or with plan NULL accept-everything filters split
+// over both FIFOs; then HAL_CAN_Start and the receive and overrun interrupts. Call once
+// MX_CAN2_Init has run and the main loop is about to consume.
+void CANRX_Start(CAN_HandleTypeDef* hcan, const CANFLT_Plan* plan);
+
+// Oldest waiting frames as one contiguous run (stops at the end of the ring, so a second
+// call may return more); 0 when the ring is empty. The frames stay valid until released.
+uint32_t CANRX_Peek(const CANRX_Frame** frames);
+// Hands the first n frames of the last Peek back to the interrupts
+void CANRX_Release(uint32_t n);
+
+void CANRX_GetStats(CANRX_Stats* stats);
+void CANRX_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,151 @@
+#pragma once
+// CAN transmit scheduling.
+//
+// Frames waiting to be sent sit in one binary heap ordered the way the bus arbitrates:
+// by identifier (standard before extended on an equal base identifier), then by the
+// order they were queued. The three bxCAN mailboxes are refilled from the top of the
+// heap, so a waiting frame never loses its place to a lower-priority one queued later.
+//
+// When the top of the heap outranks a frame already sitting in a mailbox, that mailbox
+// is aborted and its frame goes back into the heap. A high-priority frame then waits
+// for at most the frame already on the wire plus any higher-priority traffic, whatever
+// is queued behind it:
+//
+//   identifier priority (TXFP = 0)  the bxCAN sends the lowest identifier among its
+//                                   mailboxes, so only a full set of mailboxes holding
+//                                   a lower-priority frame needs one aborted
+//   FIFO priority (TXFP = 1)        the bxCAN sends in request order, so every mailbox
+//                                   loaded with a lower-priority frame is aborted
+//
+// Periodic messages are released into the same heap on their nominal schedule (no
+// drift from late sends). A message is queued at most once: if the previous instance is
+// still waiting when the next is due, the release is skipped and the waiting one goes
+// out with the newest data, which is copied when it is loaded into a mailbox. Each
+// message has a jitter bound, the latest it may reach the bus after its nominal time;
+// sends past it are counted.
+//
+// Pure computation, no HAL: can_tx.c drives it from the bxCAN registers, the host bench
+// from a model of them. The caller serialises every call.
+#include <stdint.h>
+#include "can_frame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One-shot frames that can wait at once
+#ifndef CANSCHED_QUEUE_SIZE
+#define CANSCHED_QUEUE_SIZE     32u
+#endif
+#define CANSCHED_PERIODIC_MAX   16u
+#define CANSCHED_MAILBOXES      3u
+#define CANSCHED_NONE           0xFFu
+
+typedef struct
+{
+    uint32_t id;            // 11-bit standard or 29-bit extended identifier
+    uint8_t  dlc;
+    uint8_t  flags;         // CANRX_EXT for 29-bit
+    uint8_t  reserved[2];
+    uint8_t  data[8];
+} CANSCHED_Frame;
+
+// Heap and mailbox entry
+typedef struct
+{
+    uint32_t key;           // CANSCHED_Key
+    uint32_t seq;           // queue order, kept when an aborted frame comes back
+    uint8_t  ref;           // pool slot, or CANSCHED_QUEUE_SIZE + periodic slot
+    uint8_t  reserved[3];
+} CANSCHED_Entry;
+
+typedef struct
+{
+    CANSCHED_Frame frame;   // latest data
+    uint32_t due;           // next nominal release, ms
+    uint32_t released;      // nominal release of the instance waiting or in flight
+    uint16_t period_ms;
+    uint16_t jitter_ms;
+    uint8_t  pending;       // an instance is in the heap or a mailbox
+    uint8_t  reserved[3];
+    uint32_t sent;
+    uint32_t skipped;       // releases folded into a still-waiting instance
+    uint32_t late;          // sends more than jitter_ms after their nominal time
+    uint32_t worst_ms;      // longest nominal-time-to-sent
+} CANSCHED_Periodic;
+
+typedef struct
+{
+    uint32_t queued;        // one-shot frames accepted
+    uint32_t dropped;       // one-shot frames lost to a full queue, new or replaced
+    uint32_t sent;
+    uint32_t preempted;     // aborts asked for to make way for a higher-priority frame
+    uint32_t peak;          // most frames ever waiting in the heap
+    uint32_t settled;       // completions found by CANSCHED_Settle, their flag cleared elsewhere
+} CANSCHED_Stats;
+
+typedef struct
+{
+    CANSCHED_Entry heap[CANSCHED_QUEUE_SIZE + CANSCHED_PERIODIC_MAX];
+    uint32_t count;
+    uint32_t seq;
+
+    CANSCHED_Frame pool[CANSCHED_QUEUE_SIZE];
+    uint8_t free[CANSCHED_QUEUE_SIZE];
+    uint32_t free_count;
+
+    CANSCHED_Periodic periodic[CANSCHED_PERIODIC_MAX];
+    uint32_t periodic_count;
+
+    CANSCHED_Entry mailbox[CANSCHED_MAILBOXES];
+    uint8_t loaded;         // mailboxes holding a frame, bit per mailbox
+    uint8_t aborting;       // of those, asked to abort
+    uint8_t fifo_order;     // TransmitFifoPriority
+    uint8_t reserved;
+
+    CANSCHED_Stats stats;
+} CANSCHED_State;
+
+// Arbitration order, lower wins: the base identifier, then standard before extended,
+// then the extended bits
+static inline uint32_t CANSCHED_Key(uint32_t id, uint8_t flags)
+{
+    return (flags & CANRX_EXT) ? (((id & 0x1FFC0000u) << 1) | (1u << 18) | (id & 0x3FFFFu)) : (id << 19);
+}
+
+// fifo_order: the controller runs with TransmitFifoPriority enabled
+void CANSCHED_Init(CANSCHED_State* s, uint8_t fifo_order);
+
+// Queues a copy of a one-shot frame. On a full queue it replaces the lowest-priority
+// waiting one-shot frame it outranks; 0 if there is none, and the frame is dropped.
+uint8_t CANSCHED_Queue(CANSCHED_State* s, const CANSCHED_Frame* frame);
+
+// Adds a periodic message, first due at now, with zeroed data of length dlc. jitter_ms
+// must be below period_ms. Returns its slot, or CANSCHED_NONE if it does not fit.
+uint8_t CANSCHED_AddPeriodic(CANSCHED_State* s, uint32_t id, uint8_t flags, uint8_t dlc, uint16_t period_ms,
+                             uint16_t jitter_ms, uint32_t now);
+// New data for the next instance loaded into a mailbox
+void CANSCHED_SetData(CANSCHED_State* s, uint8_t slot, const uint8_t* data, uint8_t dlc);
+// Releases the periodic messages due at now (ms); returns how many were queued
+uint32_t CANSCHED_Tick(CANSCHED_State* s, uint32_t now);
+
+// Mailbox side, after every change: Done for each completed mailbox, Settle, Preempt,
+// then Next until it returns CANSCHED_NONE. free has a bit set per empty hardware mailbox.
+//
+// Mailboxes to abort so the top frame goes next, bit per mailbox; each is asked once
+uint8_t CANSCHED_Preempt(CANSCHED_State* s, uint8_t free);
+// Takes the top frame for one of the free mailboxes and returns that mailbox, or
+// CANSCHED_NONE when nothing should be loaded now
+uint8_t CANSCHED_Next(CANSCHED_State* s, uint8_t free, CANSCHED_Frame* out);
+// A loaded mailbox completed at now (ms): sent, or aborted and back into the heap
+void CANSCHED_Done(CANSCHED_State* s, uint8_t mailbox, uint8_t sent, uint32_t now);
+// Loaded mailboxes the hardware shows empty (empty: bit per mailbox, read together with
+// the completion flags) whose completion was never seen. Without its flag only an abort
+// can have stopped a frame, since the controller retries everything else: one not asked
+// to abort was sent, one that was goes back into the heap (sent twice if the abort lost
+// the race with the wire, never lost).
+void CANSCHED_Settle(CANSCHED_State* s, uint8_t empty, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
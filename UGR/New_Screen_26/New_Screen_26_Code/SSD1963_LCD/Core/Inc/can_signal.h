@@ -0,0 +1,79 @@
+#pragma once
+// Table-driven CAN signal decoding.
+//
+// The tables come from the car's DBC file: Host/Tools/dbcgen.py turns Assets/ecu.dbc
+// into can_db.h / can_db.c at build time (cmake/candb.cmake). Each signal is stored as a
+// shift and a length on the frame's 8 data bytes read as one 64-bit word, byte-swapped
+// first for Motorola signals, so a frame is decoded with one lookup and one shift, mask
+// and multiply-add per signal.
+//
+// Decoded values land in cansig_store, one float per signal in CANSIG_Id order. Each
+// message's signals are adjacent there, so decoding a frame writes one short run.
+#include <stdint.h>
+#include "can_frame.h"
+#include "can_db.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------
+// Tables (generated)
+// -----------------------------
+// CANSIG_Def.flags; CANSIG_Message.flags has CANSIG_MOTOROLA if any of its signals do
+#define CANSIG_SIGNED       0x01u   // two's complement raw value
+#define CANSIG_MOTOROLA     0x02u   // big-endian (@0): shift is on the byte-swapped word
+
+// CANSIG_Message.key: the identifier, with this bit set for 29-bit ones
+#define CANSIG_KEY_EXT      0x80000000u
+
+typedef struct
+{
+    float    scale;
+    float    offset;
+    uint8_t  shift;         // of the raw value's LSB in the (swapped) frame word
+    uint8_t  len;           // 1..32 bits
+    uint8_t  flags;         // CANSIG_SIGNED | CANSIG_MOTOROLA
+    uint8_t  start;         // start bit as written in the DBC
+} CANSIG_Def;
+
+typedef struct
+{
+    uint32_t key;           // sorted ascending
+    uint16_t first;         // first signal in cansig_defs
+    uint8_t  dlc;           // shorter frames are not decoded
+    uint8_t  count;
+    uint8_t  flags;
+} CANSIG_Message;
+
+extern const CANSIG_Message cansig_messages[CANDB_MESSAGE_COUNT];
+extern const CANSIG_Def cansig_defs[CANDB_SIGNAL_COUNT];
+
+// -----------------------------
+// Signal store
+// -----------------------------
+#define CANSIG_UPDATED_WORDS    ((CANDB_MESSAGE_COUNT + 31) / 32)
+
+typedef struct
+{
+    float    value[CANDB_SIGNAL_COUNT];     // physical values, 0 until first received
+    uint32_t tick[CANDB_MESSAGE_COUNT];     // CANRX_Frame.tick of each message's last frame
+    uint32_t updated[CANSIG_UPDATED_WORDS]; // decoded since UI_SignalPublish, bit per CANMSG_Id
+    uint32_t frames;                        // frames decoded
+    uint32_t unknown;                       // remote frames and identifiers not in the DBC
+    uint32_t short_frames;                  // frames shorter than their DBC length, skipped
+} CANSIG_Store;
+
+extern CANSIG_Store cansig_store;
+
+static inline float CANSIG_Get(CANSIG_Id sig) { return cansig_store.value[sig]; }
+
+// Message for an identifier (CANRX_EXT in flags for 29-bit), NULL if the DBC has none
+const CANSIG_Message* CANSIG_Find(uint32_t id, uint8_t flags);
+
+// Decodes a batch of frames (CANRX_Peek) into cansig_store, in order
+void CANSIG_Decode(const CANRX_Frame* frames, uint32_t n);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+// CAN2 transmit path.
+//
+// can_sched.c decides what goes into the three bxCAN mailboxes and when; this drives it
+// from the registers. The CAN2_TX interrupt (every mailbox completion or abort) refills
+// the mailboxes, SysTick releases the periodic messages, and CANTX_Send queues one-shot
+// frames from the main loop.
+//
+// The CAN2_TX interrupt outranks SysTick and the main loop, which touch the scheduler
+// with interrupts masked for the few hundred cycles one operation takes.
+#include <stdint.h>
+#include "can.h"
+#include "can_sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    CANSCHED_Stats sched;
+    uint32_t periodic_late;     // over every periodic message
+    uint32_t periodic_skipped;
+} CANTX_Stats;
+
+// After CANRX_Start (which starts the controller): takes the mailbox interrupts and follows
+// the handle's TransmitFifoPriority
+void CANTX_Start(CAN_HandleTypeDef* hcan);
+
+// Queues a one-shot frame (CANRX_EXT in flags for 29-bit); 0 if the queue is full
+uint8_t CANTX_Send(uint32_t id, uint8_t flags, const uint8_t* data, uint8_t dlc);
+
+// Periodic message, sent every period_ms and at most jitter_ms late (can_sched.h);
+// returns the slot for CANTX_SetData, CANSCHED_NONE if it does not fit
+uint8_t CANTX_AddPeriodic(uint32_t id, uint8_t flags, uint8_t dlc, uint16_t period_ms, uint16_t jitter_ms);
+void CANTX_SetData(uint8_t slot, const uint8_t* data, uint8_t dlc);
+
+// From SysTick_Handler (USER CODE SysTick_IRQn 1), and from USER CODE 0 of CAN2_TX_IRQHandler,
+// which returns before HAL_CAN_IRQHandler, and of the two CAN2 receive handlers
+void CANTX_Tick(void);
+void CANTX_IRQHandler(void);
+
+void CANTX_GetStats(CANTX_Stats* stats);
+void CANTX_Print(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,196 @@
+#pragma once
+// System clock profiles and the peripheral timings derived from them.
+//
+// SystemClock_Config (CubeMX) leaves the part on the 16 MHz HSI; CLK_ApplyProfile then
+// switches to the profile selected with CLK_PROFILE. Bus timings are not stored as cycle
+// counts but as the nanosecond requirements of the attached devices, converted for the
+// clock that is actually running. Every table here is checked at compile time against
+// the selected profile (clock_profile.c).
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------
+// Profiles
+// -----------------------------
+#define CLK_PROFILE_HSI16       0   // reset clock, 0 wait states, VOS3
+#define CLK_PROFILE_PLL216      1   // HSE 8 MHz -> PLL 216 MHz, VOS1 + overdrive, 7 wait states
+
+#ifndef CLK_PROFILE
+#define CLK_PROFILE CLK_PROFILE_PLL216
+#endif
+
+#define CLK_HSE_HZ              8000000UL
+#define CLK_HSI_HZ              16000000UL
+
+#if CLK_PROFILE == CLK_PROFILE_HSI16
+#define CLK_SYSCLK_HZ           CLK_HSI_HZ
+#define CLK_VOS                 3
+#define CLK_OVERDRIVE           0
+#define CLK_FLASH_WS            0
+#define CLK_APB1_DIV            1
+#define CLK_APB2_DIV            1
+#elif CLK_PROFILE == CLK_PROFILE_PLL216
+#define CLK_PLLM                4   // 2 MHz VCO input
+#define CLK_PLLN                216 // 432 MHz VCO
+#define CLK_PLLP                2   // 216 MHz SYSCLK
+#define CLK_PLLQ                9   // 48 MHz for USB OTG FS
+#define CLK_SYSCLK_HZ           (CLK_HSE_HZ / CLK_PLLM * CLK_PLLN / CLK_PLLP)
+#define CLK_VOS                 1
+#define CLK_OVERDRIVE           1
+#define CLK_FLASH_WS            7
+#define CLK_APB1_DIV            4   // 54 MHz
+#define CLK_APB2_DIV            2   // 108 MHz
+#else
+#error "Unknown CLK_PROFILE"
+#endif
+
+#define CLK_HCLK_HZ             CLK_SYSCLK_HZ
+#define CLK_PCLK1_HZ            (CLK_HCLK_HZ / CLK_APB1_DIV)
+#define CLK_PCLK2_HZ            (CLK_HCLK_HZ / CLK_APB2_DIV)
+
+// Clock CubeMX sized the generated peripheral dividers for (HSI, APB /1)
+#define CLK_CUBEMX_HCLK_HZ      CLK_HSI_HZ
+#define CLK_CUBEMX_PCLK1_HZ     CLK_HSI_HZ
+
+// Smallest cycle count covering ns at hz
+#define CLK_NS_TO_CYCLES(ns, hz) \
+    ((uint32_t)((((uint64_t)(ns) * (uint64_t)(hz)) + 999999999ULL) / 1000000000ULL))
+
+// Flash wait states for HCLK at 2.7-3.6 V (RM0410 table 7: one per started 30 MHz)
+#define CLK_FLASH_WS_MIN(hclk)  (((hclk) - 1UL) / 30000000UL)
+
+// -----------------------------
+// SSD1963 8080 bus (FMC Bank1, mode A, extended)
+// -----------------------------
+// The datasheet asks for one or two controller system clocks (10-20 ns at its 100 MHz
+// PLL); the figures below add margin for the flat cable to the panel.
+#define LCD_T_AS_NS             10  // RS valid before /WR or /RD falls
+#define LCD_T_WRL_NS            20  // /WR low
+#define LCD_T_WRH_NS            20  // /WR high between two writes
+#define LCD_T_RDL_NS            50  // /RD low until read data is valid
+#define LCD_T_RDH_NS            20  // /RD high between two reads
+
+// Extended mode gives writes (BWTR1) and reads (BTR1) separate timings, so the slow read
+// strobe no longer stretches every write
+#define CLK_FMC_ADDSET(hclk)    CLK_NS_TO_CYCLES(LCD_T_AS_NS, hclk)
+#define CLK_FMC_STROBE(ns, hclk) \
+    ((CLK_NS_TO_CYCLES(ns, hclk) > 0u) ? CLK_NS_TO_CYCLES(ns, hclk) : 1u)
+// The strobe is high for ADDSET + 1 + BUSTURN cycles between two mode-A accesses
+#define CLK_FMC_RECOVERY(ns, hclk) \
+    ((CLK_NS_TO_CYCLES(ns, hclk) > CLK_FMC_ADDSET(hclk) + 1u) \
+        ? CLK_NS_TO_CYCLES(ns, hclk) - CLK_FMC_ADDSET(hclk) - 1u : 0u)
+
+#define CLK_FMC_DATAST(hclk)        CLK_FMC_STROBE(LCD_T_WRL_NS, hclk)
+#define CLK_FMC_BUSTURN(hclk)       CLK_FMC_RECOVERY(LCD_T_WRH_NS, hclk)
+#define CLK_FMC_RD_DATAST(hclk)     CLK_FMC_STROBE(LCD_T_RDL_NS, hclk)
+#define CLK_FMC_RD_BUSTURN(hclk)    CLK_FMC_RECOVERY(LCD_T_RDH_NS, hclk)
+
+typedef struct
+{
+    uint8_t addset;         // shared by both directions
+    uint8_t datast;         // write strobe (BWTR1)
+    uint8_t busturn;
+    uint8_t rd_datast;      // read strobe (BTR1)
+    uint8_t rd_busturn;
+} CLK_FmcTiming;
+
+// -----------------------------
+// I2C (UM10204 table 10)
+// -----------------------------
+// X(name, bus_hz, tLOW, tHIGH, tr, tf, tSU;DAT, tHD;DAT min, tVD;DAT max), times in ns
+#define CLK_I2C_MODES(X) \
+    X(STANDARD,  100000, 4700, 4000, 1000, 300, 250, 0, 3450) \
+    X(FAST,      400000, 1300,  600,  300, 300, 100, 0,  900) \
+    X(FAST_PLUS, 1000000, 500,  260,  120, 120,  50, 0,  450)
+
+typedef enum
+{
+#define CLK_I2C_ENUM(name, hz, low, high, tr, tf, su, hd, vd) CLK_I2C_##name,
+    CLK_I2C_MODES(CLK_I2C_ENUM)
+#undef CLK_I2C_ENUM
+    CLK_I2C_MODE_COUNT
+} CLK_I2cMode;
+
+// Mode of the touch controller bus (I2C1)
+#define CLK_I2C1_MODE           CLK_I2C_STANDARD
+
+// -----------------------------
+// CAN (bxCAN on PCLK1)
+// -----------------------------
+// A bit is 1 + BS1 + BS2 time quanta of (prescaler / PCLK1), sampled after 1 + BS1.
+// Timings aim for an 87.5% sample point (CiA 301) at an exact bit rate.
+#define CLK_CAN2_BITRATE        1000000UL
+#define CLK_CAN_SAMPLE_PERMILLE 875u
+
+// Compile-time form: the quanta per bit that reach the bit rate exactly, tried best
+// sample point first. BS2 is N / 8 rounded; BS1 tops out at 16, so above 20 quanta
+// BS2 grows instead and the sample point drops. 0 when no count fits.
+#define CLK_CAN_FITS(pclk, rate, n) \
+    ((pclk) % ((uint64_t)(rate) * (n)) == 0u && (pclk) / ((uint64_t)(rate) * (n)) <= 1024u)
+#define CLK_CAN_TRY(pclk, rate, n, next)    (CLK_CAN_FITS(pclk, rate, n) ? (n) : (next))
+#define CLK_CAN_TQ(pclk, rate) \
+    CLK_CAN_TRY(pclk, rate, 16u, CLK_CAN_TRY(pclk, rate, 8u, CLK_CAN_TRY(pclk, rate, 17u, \
+    CLK_CAN_TRY(pclk, rate, 15u, CLK_CAN_TRY(pclk, rate, 18u, CLK_CAN_TRY(pclk, rate, 9u, \
+    CLK_CAN_TRY(pclk, rate, 14u, CLK_CAN_TRY(pclk, rate, 19u, CLK_CAN_TRY(pclk, rate, 20u, \
+    CLK_CAN_TRY(pclk, rate, 10u, CLK_CAN_TRY(pclk, rate, 13u, CLK_CAN_TRY(pclk, rate, 11u, \
+    CLK_CAN_TRY(pclk, rate, 12u, CLK_CAN_TRY(pclk, rate, 21u, CLK_CAN_TRY(pclk, rate, 22u, \
+    CLK_CAN_TRY(pclk, rate, 23u, CLK_CAN_TRY(pclk, rate, 24u, CLK_CAN_TRY(pclk, rate, 25u, \
+    0u))))))))))))))))))
+#define CLK_CAN_BS2(n)              (((n) > 20u) ? (n) - 17u : ((n) + 4u) / 8u)
+#define CLK_CAN_BS1(n)              ((n) - 1u - CLK_CAN_BS2(n))
+#define CLK_CAN_SJW(n)              ((CLK_CAN_BS2(n) < 4u) ? CLK_CAN_BS2(n) : 4u)
+#define CLK_CAN_PRESCALER(pclk, rate) \
+    (CLK_CAN_TQ(pclk, rate) ? (uint32_t)((pclk) / ((uint64_t)(rate) * CLK_CAN_TQ(pclk, rate))) : 0u)
+
+typedef struct
+{
+    uint16_t prescaler;         // 1-1024
+    uint8_t  bs1;               // time quanta, 1-16
+    uint8_t  bs2;               // 1-8
+    uint8_t  sjw;               // 1-4
+    uint16_t sample_permille;   // sample point
+    uint32_t error_ppm;         // bit rate error
+} CLK_CanBitTiming;
+
+// -----------------------------
+// API
+// -----------------------------
+// Switch from the CubeMX boot clock to CLK_PROFILE. Call right after SystemClock_Config.
+void CLK_ApplyProfile(void);
+
+// FMC cycles meeting the LCD_T_* requirements at hclk_hz
+void CLK_LcdBusTiming(uint32_t hclk_hz, CLK_FmcTiming* out);
+
+// I2C TIMINGR for mode with kernel clock i2cclk_hz, 0 if it cannot be met
+uint32_t CLK_I2cTiming(uint32_t i2cclk_hz, CLK_I2cMode mode);
+
+// Runtime form: searches every prescaler and segment split for the smallest bit rate
+// error, then the sample point nearest sample_permille, then the most quanta per bit.
+// At 87.5% and an exact rate it agrees with the CLK_CAN_* macros. Returns 0 if nothing
+// comes within CLK_CAN_MAX_ERROR_PPM.
+#define CLK_CAN_MAX_ERROR_PPM   5000u
+uint8_t CLK_CanTiming(uint32_t pclk_hz, uint32_t bitrate, uint16_t sample_permille, CLK_CanBitTiming* out);
+
+#ifndef SSD1963_HOST_SIM
+#include "main.h"
+
+// Reprogram Bank1 with CLK_LcdBusTiming for the running HCLK and switch it to extended
+// mode (from MX_FMC_Init)
+void CLK_ApplyFmcTiming(SRAM_HandleTypeDef* hsram);
+
+// Reprogram TIMINGR for the running I2C kernel clock (from MX_I2C1_Init)
+void CLK_ApplyI2cTiming(I2C_HandleTypeDef* hi2c, CLK_I2cMode mode);
+
+// Reprogram the bit timing for bitrate at the running PCLK1 (from MX_CAN2_Init)
+void CLK_ApplyCanTiming(CAN_HandleTypeDef* hcan, uint32_t bitrate);
+
+// Smallest SPI_BAUDRATEPRESCALER_x keeping SCK at or below max_hz
+uint32_t CLK_SpiPrescaler(uint32_t pclk_hz, uint32_t max_hz);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
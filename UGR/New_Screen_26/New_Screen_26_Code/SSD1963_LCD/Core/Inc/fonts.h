@@ -0,0 +1,16 @@
+#pragma once
+// Fonts generated by Host/Tools/fontgen.py (Core/Src/font_*.c). The source typefaces
+// are Lato and Source Code Pro, both under the SIL Open Font License 1.1.
+#include "ssd1963_font.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const SSD1963_Font font_lato16;      // labels and warnings, 4 bpp, printable ASCII
+extern const SSD1963_Font font_mono12;      // tabular values, 2 bpp, printable ASCII
+extern const SSD1963_Font font_digits48;    // lap times, 4 bpp, " +-.0123456789:" only
+
+#ifdef __cplusplus
+}
+#endif
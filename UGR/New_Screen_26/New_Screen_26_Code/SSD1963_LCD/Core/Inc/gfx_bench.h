@@ -0,0 +1,35 @@
+#pragma once
+// Per-primitive and per-layout cost of the display stack. Runs on target (DWT cycles,
+// printed over SWO) and on the host simulator (bus counts only).
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFXBENCH_MAX_RESULTS    64
+
+typedef struct
+{
+    const char* group;      // "primitive", "cpu", "text", "shape", "tile", "blit", "blend",
+                            // "image", "chart", "capture" or "layout"
+    const char* name;
+    uint32_t cmd_writes;
+    uint32_t data_writes;
+    uint32_t dma_beats;
+    uint32_t data_reads;
+    uint32_t bus_us;        // estimated from the live FMC timing
+    uint32_t cycles;        // CPU cycles until the panel is idle again (0 on host)
+} GFXBENCH_Result;
+
+uint32_t GFXBENCH_Run(GFXBENCH_Result* out, uint32_t max);
+void GFXBENCH_Print(const GFXBENCH_Result* results, uint32_t n);
+
+#ifndef SSD1963_HOST_SIM
+// Runs every case with the L1 caches off, then on, and prints the cycles side by side
+void GFXBENCH_CacheCompare(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+// Images generated by Host/Tools/imgconv.py from Assets/ (Core/Src/img_*.c)
+#include "ssd1963_image.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern const SSD1963_Image img_dash_bg;     // 800x480 dashboard background
+extern const SSD1963_Image img_warning;     // 48x48 warning sign, over the value box colour
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+// Cache-related placement and maintenance.
+//
+// With the D-cache on, SRAM is write-back: a DMA stream reading a buffer the CPU just
+// wrote may see stale memory, and the CPU may read stale lines after a DMA write. Either
+// place the buffer in the non-cacheable DMA window (MEM_DMA_BUFFER, MPU region 3 over
+// the .dma_buffer section of the linker script) or maintain it by hand with the helpers
+// below. Flash is write-through and never needs cleaning.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MEM_CACHE_LINE          32u
+
+// Non-cacheable DMA window (STM32F767XX_FLASH.ld RAM_DMA, MPU_Config region 3)
+#define MEM_DMA_WINDOW_BASE     0x20070000UL
+#define MEM_DMA_WINDOW_SIZE     (64UL * 1024UL)
+
+#ifdef SSD1963_HOST_SIM
+#define MEM_DMA_BUFFER
+#else
+// Contents are undefined at reset: the section is NOLOAD and not zeroed by the startup
+#define MEM_DMA_BUFFER          __attribute__((section(".dma_buffer"), aligned(MEM_CACHE_LINE)))
+#endif
+
+#ifndef SSD1963_HOST_SIM
+#include "main.h"
+
+// Widen [p, p + len) to whole cache lines, which is what the SCB operations act on
+static inline void mem_cache_span(const void* p, uint32_t len, uint32_t** start, int32_t* size)
+{
+    const uint32_t a = (uint32_t)p & ~(MEM_CACHE_LINE - 1u);
+    const uint32_t end = ((uint32_t)p + len + MEM_CACHE_LINE - 1u) & ~(MEM_CACHE_LINE - 1u);
+    *start = (uint32_t*)a;
+    *size = (int32_t)(end - a);
+}
+#endif
+
+// Before a DMA stream reads memory the CPU wrote
+static inline void MEM_CleanDCache(const void* p, uint32_t len)
+{
+#ifdef SSD1963_HOST_SIM
+    (void)p; (void)len;
+#else
+    if (SCB->CCR & SCB_CCR_DC_Msk)
+    {
+        uint32_t* a; int32_t n;
+        mem_cache_span(p, len, &a, &n);
+        SCB_CleanDCache_by_Addr(a, n);
+    }
+#endif
+}
+
+// After a DMA stream wrote memory the CPU is about to read. Lines shared with other
+// data are written back first, so keep such buffers line-aligned and line-sized.
+static inline void MEM_InvalidateDCache(void* p, uint32_t len)
+{
+#ifdef SSD1963_HOST_SIM
+    (void)p; (void)len;
+#else
+    if (SCB->CCR & SCB_CCR_DC_Msk)
+    {
+        uint32_t* a; int32_t n;
+        mem_cache_span(p, len, &a, &n);
+        SCB_CleanInvalidateDCache_by_Addr(a, n);
+    }
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+// Frame-budget instrumentation: DWT cycle counting plus an optional count of every
+// transaction the display code puts on the FMC bus (build with SSD1963_BUS_PROFILE).
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint32_t cmd_writes;    // RS low writes
+    uint32_t data_writes;   // RS high writes from the CPU (parameters and pixels)
+    uint32_t dma_beats;     // RS high writes issued by DMA2
+    uint32_t data_reads;    // RS high reads (status, scanline and frame memory)
+} PERF_BusCount;
+
+// FMC Bank1 timing in HCLK cycles: ADDSET, DATAST, BUSTURN of BWTR1 for writes and of
+// BTR1 for reads (the same register for both when extended mode is off)
+typedef struct
+{
+    uint32_t hclk_hz;
+    uint8_t  addset;
+    uint8_t  datast;
+    uint8_t  busturn;
+    uint8_t  rd_datast;
+    uint8_t  rd_busturn;
+} PERF_BusTiming;
+
+// Updated by ssd1963_bus.h when SSD1963_BUS_PROFILE is defined, otherwise stays zero
+extern PERF_BusCount perf_bus;
+
+void PERF_Init(void);
+
+// Free-running CPU cycle counter (DWT->CYCCNT). Always 0 on the host build.
+uint32_t PERF_Cycles(void);
+
+// Busy-waits on the cycle counter without touching the bus (needs PERF_Init). On the
+// host build it advances the simulated clock instead.
+void PERF_DelayNs(uint32_t ns);
+
+// Timing the FMC is actually running with, read back from the controller
+void PERF_GetBusTiming(PERF_BusTiming* t);
+
+// One mode-A write: ADDSET + (DATAST + 1) + BUSTURN HCLK cycles; reads are costed the
+// same way with the read fields
+uint32_t PERF_BusWriteCycles(const PERF_BusTiming* t);
+uint32_t PERF_BusWriteNs(const PERF_BusTiming* t);
+uint32_t PERF_BusReadCycles(const PERF_BusTiming* t);
+uint32_t PERF_BusReadNs(const PERF_BusTiming* t);
+
+// Estimated time the bus needs for everything counted in c
+uint32_t PERF_BusTimeUs(const PERF_BusCount* c, const PERF_BusTiming* t);
+
+static inline void PERF_ResetBus(void)
+{
+    perf_bus.cmd_writes = 0;
+    perf_bus.data_writes = 0;
+    perf_bus.dma_beats = 0;
+    perf_bus.data_reads = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
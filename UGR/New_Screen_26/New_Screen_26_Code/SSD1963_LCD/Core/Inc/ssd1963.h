@@ -1,5 +1,6 @@
 #pragma once
 #include <stdint.h>
+#include "ssd1963_panel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -8,10 +9,89 @@ extern "C" {
 // Basic RGB565 helpers
 #define RGB565(r,g,b) (uint16_t)((((r) & 0xF8) << 8) | (((g) & 0xFC) << 3) | (((b) & 0xF8) >> 3))
 
+// Called from the DMA2 stream interrupt once an asynchronous fill has finished.
+typedef void (*SSD1963_DoneCallback)(void);
+
+// Bus writes spent by one SSD1963_SetWindow call (3 commands + 8 parameter bytes)
+#define SSD1963_WINDOW_WRITES   11
+
+// Blocking bring-up: reset, PLL, panel timing, display on (about 100 ms of waits)
 void SSD1963_Init(void);
+
+// The same bring-up without blocking. SSD1963_InitStart asserts reset; every
+// SSD1963_InitStep call then runs the steps whose wait has passed and returns the ms until
+// the next one is due, 0 once the controller is configured. Steps are short, so
+// InitStep may run from the SysTick interrupt while the caller does other work; nothing
+// else may use the controller until SSD1963_InitDone. The display is left off: draw
+// the first frame, then SSD1963_DisplayOn.
+void SSD1963_InitStart(void);
+uint32_t SSD1963_InitStep(void);
+uint8_t SSD1963_InitDone(void);
+void SSD1963_DisplayOn(uint8_t on);
 void SSD1963_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void SSD1963_Fill(uint16_t rgb565);
 
+// Non-blocking fills: DMA2 streams the colour into the FMC data port while the CPU
+// carries on. A new call (or any blocking draw) waits for the previous fill first.
+// The rectangle is cut to the panel; if nothing is left, or its corners are reversed,
+// no transfer starts and done is not called.
+void SSD1963_FillAsync(uint16_t rgb565, SSD1963_DoneCallback done);
+void SSD1963_FillRectAsync(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                           uint16_t rgb565, SSD1963_DoneCallback done);
+// Stream a (x1-x0+1) * (y1-y0+1) pixel array into the window by DMA. pixels must stay
+// untouched until done and be visible to DMA2 (memory_map.h: MEM_DMA_BUFFER, or cleaned).
+// A window with reversed corners or reaching off the panel is refused the same way.
+void SSD1963_BlitAsync(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                       const uint16_t* pixels, SSD1963_DoneCallback done);
+uint8_t SSD1963_IsBusy(void);
+void SSD1963_WaitIdle(void);
+
+// Frame memory read-back (0x2E read_memory_start, 0x3E read_memory_continue). Pixels come
+// out of the window row by row in the format they were written. ReadContinue resumes
+// after other commands went to the controller in between. Reads use the FMC read timing
+// (BTR1), slower than writes.
+void SSD1963_ReadWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+void SSD1963_ReadContinue(void);
+void SSD1963_ReadPixels(uint16_t* out, uint32_t n);
+
+// -----------------------------
+// Scan position and tearing effect
+// -----------------------------
+// Panel refresh timing as programmed by SSD1963_Init (0xB6 / 0xB4 / 0xE6)
+typedef struct
+{
+    uint16_t lines;         // VT: scanlines per frame, blanking included
+    uint16_t first_row;     // VPS: scanline that drives panel row 0
+    uint32_t line_ns;       // duration of one scanline
+} SSD1963_ScanTiming;
+
+// 0x35 set_tear_on modes
+#define SSD1963_TEAR_VBLANK     0x00    // TE pulses during vertical blanking only
+#define SSD1963_TEAR_VHBLANK    0x01    // TE pulses during vertical and horizontal blanking
+
+void SSD1963_GetScanTiming(SSD1963_ScanTiming* t);
+
+// Scanline the controller is currently sending to the glass (0x45 get_scanline),
+// 0 .. lines-1 counted from the vertical sync pulse
+uint16_t SSD1963_GetScanline(void);
+
+void SSD1963_SetTearOn(uint8_t mode);
+void SSD1963_SetTearOff(void);
+void SSD1963_SetTearScanline(uint16_t line);
+
+// -----------------------------
+// Vertical scrolling
+// -----------------------------
+// The panel rows split into a fixed top area, a scrolling area and a fixed bottom area
+// (0x33 set_scroll_area), tfa + vsa + bfa = SSD_VER_RESOLUTION. Scrolling only changes
+// which frame memory line the controller sends to each row: writes still address frame
+// memory, and the scroll runs along whole lines, so it is vertical on this landscape panel.
+void SSD1963_SetScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa);
+
+// Frame memory line shown on the first row of the scrolling area (0x37 set_scroll_start),
+// tfa .. tfa + vsa - 1. Row tfa + k then shows line tfa + (line - tfa + k) % vsa.
+void SSD1963_SetScrollStart(uint16_t line);
+
 #ifdef __cplusplus
 }
 #endif
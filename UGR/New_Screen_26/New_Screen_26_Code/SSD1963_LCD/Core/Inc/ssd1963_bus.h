@@ -0,0 +1,69 @@
+#pragma once
+// Private to the SSD1963 driver and its graphics layers: raw FMC access to the controller.
+#include <stdint.h>
+#include "main.h"
+#include "dma.h"
+
+// -----------------------------
+// FMC address mapping
+// -----------------------------
+// Bank1/NE1 base is 0x6000_0000.
+// With LCD_RS connected to FMC_A16, the "data" address is typically base + 0x20000 on a 16-bit bus.
+//
+// If you ever suspect RS is inverted, swap CMD/DATA addresses below.
+#define LCD_FMC_BASE   (0x60000000UL)
+#define LCD_CMD_ADDR   (LCD_FMC_BASE)
+#define LCD_DATA_ADDR  (LCD_FMC_BASE + 0x00020000UL)
+
+// -----------------------------
+// Transaction counting (perf.h)
+// -----------------------------
+#ifdef SSD1963_BUS_PROFILE
+#include "perf.h"
+#define LCD_BUS_COUNT(field, n)  (perf_bus.field += (n))
+#else
+#define LCD_BUS_COUNT(field, n)  ((void)0)
+#endif
+
+#ifdef SSD1963_HOST_SIM
+// Host build (Host/CMakeLists.txt): the "bus" is the command-stream decoder in ssd1963_sim.c
+#include "ssd1963_sim.h"
+
+static inline void lcd_cmd(uint16_t c)  { LCD_BUS_COUNT(cmd_writes, 1);  SIM_BusCmd(c); }
+static inline void lcd_dat(uint16_t d)  { LCD_BUS_COUNT(data_writes, 1); SIM_BusData(d); }
+static inline uint16_t lcd_rd(void)     { LCD_BUS_COUNT(data_reads, 1);  return SIM_BusRead(); }
+#else
+static inline void lcd_cmd(uint16_t c)  { LCD_BUS_COUNT(cmd_writes, 1);  *(__IO uint16_t*)LCD_CMD_ADDR  = c; }
+static inline void lcd_dat(uint16_t d)  { LCD_BUS_COUNT(data_writes, 1); *(__IO uint16_t*)LCD_DATA_ADDR = d; }
+static inline uint16_t lcd_rd(void)     { LCD_BUS_COUNT(data_reads, 1);  return *(__IO uint16_t*)LCD_DATA_ADDR; }
+#endif
+
+// -----------------------------
+// Pixel streams (ssd1963.c)
+// -----------------------------
+// n data writes of one colour, or of n pixels from src, with the same effect as n
+// lcd_dat calls. On target they store two pixels per 32-bit access, four accesses per
+// STM: the FMC splits each word into two 16-bit bus cycles, low halfword first, and
+// RS (A16) stays high for every address of the burst. The bus cycles are unchanged; what
+// goes is the per-pixel store and loop overhead on the CPU and the AXI transaction per
+// halfword. GFXBENCH compares both ("Fill halfword" / "Fill (CPU)").
+void lcd_dat_fill(uint16_t d, uint32_t n);
+void lcd_dat_copy(const uint16_t* src, uint32_t n);
+
+// Kick DMA2_Stream0 to move beats halfwords from src into the data port, either repeating
+// *src (fills) or walking through src (blits). The stream is idle here, so the source
+// increment can be switched in CR without a full HAL_DMA_Init.
+// Completion is reported through hdma_memtomem_dma2_stream0.XferCpltCallback.
+static inline HAL_StatusTypeDef lcd_dma_start(const uint16_t* src, uint32_t beats, uint8_t src_inc)
+{
+    DMA_HandleTypeDef* hdma = &hdma_memtomem_dma2_stream0;
+
+    LCD_BUS_COUNT(dma_beats, beats);
+    hdma->Init.PeriphInc = src_inc ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+#ifdef SSD1963_HOST_SIM
+    return SIM_DmaStart(hdma, src, beats);
+#else
+    MODIFY_REG(hdma->Instance->CR, DMA_SxCR_PINC, hdma->Init.PeriphInc);
+    return HAL_DMA_Start_IT(hdma, (uint32_t)src, LCD_DATA_ADDR, beats);
+#endif
+}
@@ -0,0 +1,33 @@
+#pragma once
+// Screenshots read back from SSD1963 frame memory.
+//
+// A capture reads the area one row at a time over the FMC and hands each row to a byte
+// sink: a file on the SD card, a USB bulk endpoint, or on the host a plain FILE. Nothing
+// is written to the controller except the read window, so capturing does not disturb
+// what is on the glass. What comes back is frame memory, i.e. exactly the pixels the
+// driver wrote, ready to be compared with the host simulator's rendering of the same
+// frame. Vertical scrolling (ssd1963.h) is not applied.
+#include <stdint.h>
+#include "ssd1963_gfx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum
+{
+    SSD1963_CAPTURE_RGB565 = 0,     // raw pixels, little-endian, no header
+    SSD1963_CAPTURE_PPM             // binary PPM (P6), RGB888
+} SSD1963_CaptureFormat;
+
+// Consumes the next len bytes of the capture. Returns 0 to abort it.
+typedef uint8_t (*SSD1963_CaptureSink)(void* ctx, const uint8_t* data, uint32_t len);
+
+// Capture area (clipped to the panel, the draw clip is ignored). Returns 1 once every
+// byte has gone to sink, 0 if the area is empty or the sink aborted.
+uint8_t SSD1963_Capture(const SSD1963_Rect* area, SSD1963_CaptureFormat format,
+                        SSD1963_CaptureSink sink, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+// Anti-aliased bitmap text.
+//
+// Fonts are generated offline by Host/Tools/fontgen.py into const tables (flash): one
+// packed 1, 2 or 4 bpp coverage bitmap per glyph, MSB first, rows not padded, each glyph
+// starting on a byte boundary. Text is drawn opaque: every character is one cell, the
+// glyph's advance wide and the font's line height tall, written with a single
+// SSD1963_SetWindow followed by one run of pixels (background, then glyph rows, then
+// background). The glyph pixels are blended against the background once and kept in a
+// small RAM cache, so repeated values cost only their bus writes.
+#include <stdint.h>
+#include "ssd1963.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint32_t offset;    // first byte in SSD1963_Font.bitmap
+    uint8_t width;      // bitmap box, 0 for blank glyphs
+    uint8_t height;
+    int8_t x_off;       // box origin relative to the pen position
+    int8_t y_off;       // and the baseline (negative is above it)
+    uint8_t advance;    // pen movement, 0 if the font has no such glyph
+} SSD1963_Glyph;
+
+typedef struct
+{
+    const uint8_t* bitmap;
+    const SSD1963_Glyph* glyphs;    // first .. last, contiguous
+    uint8_t first;
+    uint8_t last;
+    uint8_t bpp;                    // 1, 2 or 4
+    uint8_t line_height;            // cell height
+    uint8_t ascent;                 // baseline below the cell top
+} SSD1963_Font;
+
+// Pre-blended glyph pixels kept in RAM, and the number of glyphs they are spread over
+#ifndef SSD1963_GLYPH_CACHE_PIXELS
+#define SSD1963_GLYPH_CACHE_PIXELS  8192
+#endif
+#ifndef SSD1963_GLYPH_CACHE_SLOTS
+#define SSD1963_GLYPH_CACHE_SLOTS   96
+#endif
+
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;        // glyphs blended into the cache
+    uint32_t evictions;
+    uint32_t uncached;      // glyphs larger than the whole cache, blended row by row
+} SSD1963_FontCacheStats;
+
+// Draw c with its cell's top-left corner at (x, y). Returns the pen position after it.
+int16_t SSD1963_DrawChar(int16_t x, int16_t y, const SSD1963_Font* font, char c,
+                         uint16_t fg, uint16_t bg);
+
+// Draw a string; '\n' starts a new line at x. Returns the pen position after the last
+// character.
+int16_t SSD1963_DrawText(int16_t x, int16_t y, const SSD1963_Font* font, const char* text,
+                         uint16_t fg, uint16_t bg);
+
+// Width in pixels of the widest line of text
+int16_t SSD1963_TextWidth(const SSD1963_Font* font, const char* text);
+
+// For layers that blend text over their own pixels (tile_render.h): the glyph of c, or
+// NULL if the font has none, and one row of its coverage as 0..255 per pixel.
+const SSD1963_Glyph* SSD1963_FontGlyph(const SSD1963_Font* font, char c);
+void SSD1963_GlyphCoverage(const SSD1963_Font* font, const SSD1963_Glyph* g, uint32_t row, uint8_t* out);
+
+void SSD1963_FontCacheFlush(void);
+void SSD1963_GetFontCacheStats(SSD1963_FontCacheStats* out);
+
+#ifdef __cplusplus
+}
+#endif
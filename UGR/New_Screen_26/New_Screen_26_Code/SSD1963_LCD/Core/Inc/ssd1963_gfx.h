@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include "ssd1963.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Inclusive rectangle in panel coordinates (same convention as SSD1963_SetWindow)
+typedef struct
+{
+    int16_t x0, y0;
+    int16_t x1, y1;
+} SSD1963_Rect;
+
+// Every primitive below is clipped against this rectangle (and the panel) before any
+// window is opened, so only the visible part of a shape ever crosses the FMC bus.
+// Passing NULL restores the full panel.
+void SSD1963_SetClip(const SSD1963_Rect* clip);
+void SSD1963_GetClip(SSD1963_Rect* clip);
+
+// Returns 1 and writes the clipped area to out if anything of r is visible.
+uint8_t SSD1963_ClipRect(const SSD1963_Rect* r, SSD1963_Rect* out);
+
+void SSD1963_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t rgb565);
+void SSD1963_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t rgb565);
+void SSD1963_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t rgb565);
+void SSD1963_DrawPixel(int16_t x, int16_t y, uint16_t rgb565);
+
+// Copy a w*h RGB565 array (row-major, stride w) to (x, y)
+void SSD1963_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+// Compressed RGB565 images.
+//
+// Assets are converted at build time by Host/Tools/imgconv.py into const byte streams
+// (flash) and decoded straight into the FMC data port: one SSD1963_SetWindow per image,
+// then every visible pixel as it comes out of the decoder. The only RAM the decoder needs
+// is one row of pixels for the "copy from above" op.
+//
+// Stream: ops of one tag byte, tt nnnnnn, with count = nnnnnn + 1, or for nnnnnn = 63 a
+// count of 64 plus the LEB128 number that follows. Ops may cross row ends.
+//   00 RUN      count pixels of the last colour
+//   01 LITERAL  count little-endian RGB565 values follow
+//   10 FILL     one RGB565 value follows and becomes the last colour, then as RUN
+//   11 ABOVE    count pixels copied from the row above (black above the first row)
+#include <stdint.h>
+#include "ssd1963.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint16_t width;             // at most SSD_HOR_RESOLUTION
+    uint16_t height;
+    uint32_t size;              // bytes in data
+    const uint8_t* data;
+} SSD1963_Image;
+
+// Draw img with its top-left corner at (x, y), clipped like every other primitive.
+// Returns 0 if the stream is malformed (the window is then padded out with black).
+uint8_t SSD1963_DrawImage(int16_t x, int16_t y, const SSD1963_Image* img);
+
+#ifdef __cplusplus
+}
+#endif
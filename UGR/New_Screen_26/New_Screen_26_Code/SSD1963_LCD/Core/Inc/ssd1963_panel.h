@@ -0,0 +1,76 @@
+#pragma once
+// SSD1963 panel profiles.
+//
+// The panel is chosen at build time with SSD1963_PANEL (CMake cache option of the same
+// name). Geometry and timing are plain constants, so the init sequence, the full-screen
+// loops and every buffer sized from the resolution are built for that one panel; nothing
+// branches on geometry at run time. ssd1963.c checks the selected profile against the
+// controller's limits at compile time.
+//
+// Porches follow the SSD1963 register layout: the back porch is counted from the start of
+// the sync pulse (HPS / VPS of 0xB4 / 0xB6), the front porch from the end of the active area.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------
+// Profiles
+// -----------------------------
+#define SSD1963_PANEL_480X272   0   // 4.3", 9 MHz pixel clock
+#define SSD1963_PANEL_800X480   1   // 5" / 7", 25 MHz (the vendor example the driver was ported from)
+#define SSD1963_PANEL_1024X600  2   // 7", 51.2 MHz
+
+#ifndef SSD1963_PANEL
+#define SSD1963_PANEL SSD1963_PANEL_800X480
+#endif
+
+#if SSD1963_PANEL == SSD1963_PANEL_480X272
+#define SSD1963_PANEL_NAME      "480x272"
+#define SSD_HOR_RESOLUTION      480
+#define SSD_VER_RESOLUTION      272
+#define SSD_HOR_PULSE_WIDTH     41
+#define SSD_HOR_BACK_PORCH      43
+#define SSD_HOR_FRONT_PORCH     2
+#define SSD_VER_PULSE_WIDTH     10
+#define SSD_VER_BACK_PORCH      12
+#define SSD_VER_FRONT_PORCH     2
+#define SSD_PCLK_HZ             9000000UL
+#elif SSD1963_PANEL == SSD1963_PANEL_800X480
+#define SSD1963_PANEL_NAME      "800x480"
+#define SSD_HOR_RESOLUTION      800
+#define SSD_VER_RESOLUTION      480
+#define SSD_HOR_PULSE_WIDTH     1
+#define SSD_HOR_BACK_PORCH      46
+#define SSD_HOR_FRONT_PORCH     210
+// The vendor example programs VPW as the front porch less one; the panel runs with it
+#define SSD_VER_PULSE_WIDTH     22
+#define SSD_VER_BACK_PORCH      23
+#define SSD_VER_FRONT_PORCH     22
+#define SSD_PCLK_HZ             25000000UL
+#elif SSD1963_PANEL == SSD1963_PANEL_1024X600
+#define SSD1963_PANEL_NAME      "1024x600"
+#define SSD_HOR_RESOLUTION      1024
+#define SSD_VER_RESOLUTION      600
+#define SSD_HOR_PULSE_WIDTH     20
+#define SSD_HOR_BACK_PORCH      160
+#define SSD_HOR_FRONT_PORCH     160
+#define SSD_VER_PULSE_WIDTH     3
+#define SSD_VER_BACK_PORCH      23
+#define SSD_VER_FRONT_PORCH     12
+#define SSD_PCLK_HZ             51200000UL
+#else
+#error "Unknown SSD1963_PANEL"
+#endif
+
+// Derived scan geometry (0xB4 / 0xB6)
+#define SSD_HT                  (SSD_HOR_RESOLUTION + SSD_HOR_BACK_PORCH + SSD_HOR_FRONT_PORCH)
+#define SSD_HPS                 (SSD_HOR_BACK_PORCH)
+#define SSD_VT                  (SSD_VER_RESOLUTION + SSD_VER_BACK_PORCH + SSD_VER_FRONT_PORCH)
+#define SSD_VPS                 (SSD_VER_BACK_PORCH)
+
+#define SSD_PANEL_PIXELS        ((uint32_t)SSD_HOR_RESOLUTION * (uint32_t)SSD_VER_RESOLUTION)
+
+#ifdef __cplusplus
+}
+#endif
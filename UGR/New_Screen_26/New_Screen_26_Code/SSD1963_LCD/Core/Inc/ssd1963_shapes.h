@@ -0,0 +1,50 @@
+#pragma once
+// Lines, circles, arcs and convex polygons for gauges.
+//
+// Every shape is rasterised top to bottom into horizontal spans, and spans that continue
+// the rectangle of the row above (same columns) are merged before anything is sent, so
+// a vertical stretch of a line or the flat middle of a disc costs one SSD1963_SetWindow.
+// Pixel centres are at integer coordinates; circles and rings contain the pixels whose
+// centre is within half a pixel of the nominal radius.
+#include <stdint.h>
+#include "ssd1963_gfx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    int16_t x, y;
+} SSD1963_Point;
+
+// Angles are binary: SSD1963_ANGLE_TURN units per revolution, 0 pointing right
+// (3 o'clock) and growing clockwise on the panel, which is how sweep gauges move.
+#define SSD1963_ANGLE_TURN      65536L
+#define SSD1963_DEG(d)          ((int32_t)(((int64_t)(d) * SSD1963_ANGLE_TURN) / 360))
+
+// sin and cos in Q15 (32767 = 1.0) from a quarter-wave table built at compile time
+int16_t SSD1963_Sin(int32_t angle);
+int16_t SSD1963_Cos(int32_t angle);
+
+void SSD1963_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t rgb565);
+
+// Line width pixels wide, with square ends at the two points (needles)
+void SSD1963_DrawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+                           uint16_t rgb565);
+
+// Convex polygon, vertices in either winding order, at most SSD1963_POLY_MAX of them
+#define SSD1963_POLY_MAX        8
+void SSD1963_FillConvex(const SSD1963_Point* pts, uint8_t n, uint16_t rgb565);
+
+void SSD1963_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t rgb565);
+void SSD1963_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t rgb565);
+
+// Ring sector: radius r outside, thickness pixels wide, starting at angle start and
+// sweeping clockwise by sweep (SSD1963_ANGLE_TURN or more is a full ring)
+void SSD1963_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t thickness,
+                     int32_t start, int32_t sweep, uint16_t rgb565);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+// Strip renderer for composited scenes.
+//
+// A whole RGB565 frame (768 KB) does not fit in SRAM, so scenes that need real blending
+// (translucent overlays, anti-aliased text on gradients) are rendered in strips of
+// TILE_ROWS rows into one of two buffers in the non-cacheable DMA window. While the CPU
+// renders strip n into one buffer, DMA2 pushes strip n-1 from the other into its
+// SSD1963 window, so rendering and bus time overlap instead of adding up. Each strip
+// reaches the panel exactly once, fully composited, so nothing flickers.
+#include <stdint.h>
+#include "ssd1963_gfx.h"
+#include "ssd1963_font.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TILE_ROWS       16
+#define TILE_WIDTH      SSD_HOR_RESOLUTION
+
+// Strip being rendered: pixels[(y - area.y0) * stride + (x - area.x0)] for the panel
+// coordinates (x, y) inside area
+typedef struct
+{
+    uint16_t* pixels;
+    SSD1963_Rect area;
+    uint16_t stride;
+} TILE_Target;
+
+// Paints the scene into one strip. Called top to bottom, once per strip.
+typedef void (*TILE_RenderFn)(const TILE_Target* tile);
+
+typedef struct
+{
+    uint32_t strips;
+    uint32_t render_cycles;     // CPU time inside the TILE_RenderFn
+    uint32_t wait_cycles;       // CPU time spent waiting for the previous strip's DMA
+} TILE_Stats;
+
+// Render area (clipped like every primitive) through render and stream it to the panel.
+// Returns once the last strip has been handed to DMA; SSD1963_WaitIdle to wait for it.
+void TILE_Render(const SSD1963_Rect* area, TILE_RenderFn render);
+
+void TILE_GetStats(TILE_Stats* out);
+void TILE_ResetStats(void);
+
+// -----------------------------
+// Drawing into a strip
+// -----------------------------
+// All coordinates are panel coordinates; everything is clipped to the strip.
+void TILE_Fill(const TILE_Target* t, const SSD1963_Rect* r, uint16_t rgb565);
+
+// alpha 0 (keep) .. 255 (replace), over whatever the strip already holds
+void TILE_FillAlpha(const TILE_Target* t, const SSD1963_Rect* r, uint16_t rgb565, uint8_t alpha);
+
+// Vertical gradient from top at r->y0 to bottom at r->y1
+void TILE_FillGradient(const TILE_Target* t, const SSD1963_Rect* r, uint16_t top, uint16_t bottom);
+
+// Images placed with their top-left corner at (x, y). Fills, copies, overlay blends and
+// palette expansion go through blit2d.h, so with the DMA2D backend they run on the
+// Chrom-ART engine; image data must stay valid until TILE_Render returns.
+void TILE_Blit(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels);
+void TILE_BlendArgb8888(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint32_t* pixels);
+void TILE_BlendArgb4444(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint16_t* pixels);
+void TILE_BlitL8(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* indices,
+                 const uint32_t* clut, uint16_t clut_size);
+
+// RGB565 images with a separate alpha plane (blend565.h), on the CPU: one alpha byte per
+// pixel, or two 4-bit alphas per byte with the mask rows packed back to back
+void TILE_BlendA8(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels,
+                  const uint8_t* alpha);
+void TILE_BlendA4(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels,
+                  const uint8_t* alpha4);
+
+// Transparent anti-aliased text, blended onto the strip. Returns the pen position.
+int16_t TILE_DrawText(const TILE_Target* t, int16_t x, int16_t y, const SSD1963_Font* font,
+                      const char* text, uint16_t fg);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+// Rolling strip chart on the SSD1963 hardware scroll.
+//
+// Repainting a chart to shift its history costs every pixel of it. Instead the chart
+// owns the scrolling area of the panel (ssd1963.h, 0x33 / 0x37): each new sample is
+// drawn as one line of frame memory, and the scroll start is moved so that this line
+// shows at the top of the band while the older ones slide down by a row. One sample
+// costs one line of bus writes, whatever the chart's depth.
+//
+// The SSD1963 scrolls whole lines, so on this landscape panel time runs down the screen
+// and the band is the full panel width; traces sit side by side in their own lanes.
+// There is a single scroll area, hence a single chart. Nothing else may draw into the
+// band while the chart runs: writes there land on frame memory lines, not panel rows.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define UI_CHART_MAX_TRACES     4
+
+typedef struct
+{
+    int16_t x0;             // lane, panel columns
+    int16_t x1;
+    int32_t min;            // sample value drawn at x0
+    int32_t max;            // and at x1; values outside are clamped
+    uint16_t colour;
+} UI_ChartTrace;
+
+typedef struct
+{
+    int16_t y0;             // band: panel rows y0 .. y0 + rows - 1
+    int16_t rows;           // lanes and band are cut to the panel profile
+    uint16_t bg;
+    uint16_t grid;          // lane borders and time ticks
+    uint16_t grid_every;    // samples between time ticks, 0 for none
+    uint8_t traces;
+    UI_ChartTrace trace[UI_CHART_MAX_TRACES];
+} UI_Chart;
+
+// Takes over the scroll area and clears the band. chart must stay valid until
+// UI_ChartStop.
+void UI_ChartStart(const UI_Chart* chart);
+
+// Append one sample per trace (chart->traces values) as the new top row
+void UI_ChartPush(const int32_t* samples);
+
+// Give the whole panel back to normal drawing. The band's frame memory is left in
+// scrolled order, so whatever owns that area next must repaint it.
+void UI_ChartStop(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+#include "ssd1963_gfx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum number of separate regions kept per frame. When full, the two regions that
+// are cheapest to combine get merged, so invalidation never fails.
+#define UI_DIRTY_MAX    16
+
+// Repaints everything that intersects area. The clip is already set to area, so the
+// callback can simply draw its widgets with the normal SSD1963_* primitives.
+typedef void (*UI_RedrawFn)(const SSD1963_Rect* area);
+
+void UI_Invalidate(const SSD1963_Rect* r);
+void UI_InvalidateAll(void);
+uint8_t UI_IsDirty(void);
+
+// Flush this frame's merged regions through redraw and clear the list.
+// Regions redraw invalidates are kept for the next flush.
+// Returns the number of regions flushed.
+uint8_t UI_Flush(UI_RedrawFn redraw);
+
+// Move this frame's merged regions into out (UI_DIRTY_MAX entries) and clear the list,
+// for flush schedulers that decide their own order (ui_vsync.h). Returns the count.
+uint8_t UI_TakeDirty(SSD1963_Rect* out);
+
+#ifdef __cplusplus
+}
+#endif
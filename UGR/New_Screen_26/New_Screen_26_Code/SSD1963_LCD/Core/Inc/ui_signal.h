@@ -0,0 +1,57 @@
+#pragma once
+// CAN signals to dirty regions.
+//
+// Widgets subscribe to decoded signals (can_signal.h), each subscription with a deadband
+// in the signal's physical units. CANSIG_Decode marks the messages it decoded;
+// UI_SignalPublish then looks only at those messages' signals, and only at the
+// subscriptions of each, and invalidates (ui_dirty.h) the widgets whose value has moved
+// by more than the deadband since they were last repainted for it. Repaint work follows
+// what changed on the bus instead of every value being compared every frame.
+//
+// The subscriptions are kept as a compressed adjacency table in static storage, built
+// once by UI_SignalBind: for each signal, the run of its subscriptions.
+#include <stdint.h>
+#include "ssd1963_gfx.h"
+#include "can_signal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Widgets one binding takes (the changed set is a 32-bit mask) and subscriptions over all of them
+#define UI_SIGNAL_MAX_WIDGETS   32u
+#define UI_SIGNAL_MAX_SUBS      64u
+
+typedef struct
+{
+    CANSIG_Id signal;
+    uint8_t   widget;       // index into the widget areas
+    float     deadband;     // change that repaints; 0 repaints on any change
+} UI_SignalSub;
+
+typedef struct
+{
+    uint32_t messages;      // decoded messages looked at
+    uint32_t checks;        // subscriptions compared
+    uint32_t changes;       // of those, moved past their deadband
+    uint32_t invalidated;   // widget areas handed to UI_Invalidate
+} UI_SignalStats;
+
+// Replaces the binding. widgets holds each widget's screen area and must outlive the
+// binding. Every subscription starts from the signal's current value. Returns 0, leaving
+// nothing bound, if a count is over its limit or a subscription names a missing widget.
+uint8_t UI_SignalBind(const SSD1963_Rect* widgets, uint8_t nwidgets, const UI_SignalSub* subs, uint32_t nsubs);
+
+// After CANSIG_Decode, from the same loop: invalidates the widgets whose signals moved.
+// Returns the number of widgets invalidated.
+uint32_t UI_SignalPublish(void);
+
+// Widgets invalidated by UI_SignalPublish since the last call, bit per widget, so the
+// redraw only reformats those
+uint32_t UI_SignalTakeChanged(void);
+
+void UI_SignalGetStats(UI_SignalStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+// Tear-free flushing. The SSD1963 refreshes the glass from its frame memory on its own
+// clock; writing a region while the scan passes through it shows half old, half new
+// content for a frame. The TE output is not routed to the MCU on this board, so the
+// scheduler polls the scan position (0x45 get_scanline) instead.
+#include <stdint.h>
+#include "ui_dirty.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Regions are split into bands that can each be written in one pass behind the scan,
+// so a flush can hold more jobs than the dirty list has regions
+#define UI_VSYNC_MAX_JOBS       32
+
+// Scanlines of slack kept between the write pointer and the scan for the time spent
+// reading the scanline and setting up the window
+#define UI_VSYNC_MARGIN_LINES   4
+
+// Called when the scan wraps to the top of the frame (start of vertical sync)
+typedef void (*UI_FrameHook)(void);
+
+typedef struct
+{
+    uint32_t frames;        // frame starts seen while polling
+    uint32_t jobs;          // bands written by UI_FlushSynced
+    uint32_t splits;        // extra bands from regions too tall for one pass
+    uint32_t forced;        // bands written after waiting a whole frame for a safe slot
+    uint32_t polls;         // scanline reads spent waiting for the scan to move on
+    uint32_t px_ns;         // learned cost of one redrawn pixel, overdraw included
+} UI_VsyncStats;
+
+// Programs TE for vertical blanking and seeds the per-pixel cost from the FMC timing
+void UI_VsyncInit(void);
+void UI_SetFrameBeginHook(UI_FrameHook hook);
+
+// Reads the scanline once; returns 1 (after running the hook) if a frame started
+// since the previous read
+uint8_t UI_VsyncPoll(void);
+
+// Blocks until the next frame start, or about two frame periods if the panel does not answer
+void UI_WaitFrameBegin(void);
+
+// UI_Flush, but each region is written only while the scan cannot overtake the write
+// pointer inside it. Returns the number of bands written.
+uint8_t UI_FlushSynced(UI_RedrawFn redraw);
+
+void UI_GetVsyncStats(UI_VsyncStats* out);
+
+#ifdef __cplusplus
+}
+#endif
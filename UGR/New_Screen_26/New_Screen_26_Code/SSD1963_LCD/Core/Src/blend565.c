@@ -0,0 +1,137 @@
+#include "blend565.h"
+#include "main.h"
+
+// -----------------------------
+// Reference
+// -----------------------------
+uint16_t BLEND_Pixel(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    const uint32_t a = alpha;
+    const uint32_t ia = 255u - a;
+    const uint32_t r = ((uint32_t)(fg >> 11) * a + (uint32_t)(bg >> 11) * ia + 127u) / 255u;
+    const uint32_t g = ((uint32_t)((fg >> 5) & 0x3Fu) * a + (uint32_t)((bg >> 5) & 0x3Fu) * ia + 127u) / 255u;
+    const uint32_t b = ((uint32_t)(fg & 0x1Fu) * a + (uint32_t)(bg & 0x1Fu) * ia + 127u) / 255u;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static inline uint8_t blend_a4(const uint8_t* alpha4, uint32_t i)
+{
+    const uint32_t n = (i & 1u) ? (alpha4[i >> 1] >> 4) : (alpha4[i >> 1] & 0x0Fu);
+    return (uint8_t)(n * 17u);
+}
+
+void BLEND_RefColour(uint16_t* dst, uint16_t rgb565, uint8_t alpha, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) dst[i] = BLEND_Pixel(rgb565, dst[i], alpha);
+}
+
+void BLEND_RefColourA8(uint16_t* dst, uint16_t rgb565, const uint8_t* alpha, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) dst[i] = BLEND_Pixel(rgb565, dst[i], alpha[i]);
+}
+
+void BLEND_RefImageA8(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) dst[i] = BLEND_Pixel(src[i], dst[i], alpha[i]);
+}
+
+void BLEND_RefImageA4(uint16_t* dst, const uint16_t* src, const uint8_t* alpha4, uint32_t first, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) dst[i] = BLEND_Pixel(src[i], dst[i], blend_a4(alpha4, first + i));
+}
+
+// -----------------------------
+// Two pixels at a time
+// -----------------------------
+// f and b hold pixel 0 in the low and pixel 1 in the high halfword. For each channel
+// and pixel, PKHBT / PKHTB pair the foreground with the background value and SMLAD
+// forms fg * a + bg * (255 - a) + 128 in one step; (s + (s >> 8)) >> 8 is then exactly
+// the reference's (x + 127) / 255 for every sum a 6-bit channel can produce.
+static inline uint32_t blend_channel(uint32_t f, uint32_t b, uint32_t w0, uint32_t w1,
+                                     uint32_t shift, uint32_t mask)
+{
+    const uint32_t fc = (f >> shift) & mask;
+    const uint32_t bc = (b >> shift) & mask;
+    const uint32_t s0 = __SMLAD(__PKHBT(fc, bc, 16), w0, 128u);
+    const uint32_t s1 = __SMLAD(__PKHTB(bc, fc, 16), w1, 128u);
+    return ((((s0 + (s0 >> 8)) >> 8)) | (((s1 + (s1 >> 8)) >> 8) << 16)) << shift;
+}
+
+// a01: alpha of pixel 0 in bits 0-7, of pixel 1 in bits 16-23
+static inline uint32_t blend_pair(uint32_t f, uint32_t b, uint32_t a01)
+{
+    const uint32_t ia01 = 0x00FF00FFu - a01;
+    const uint32_t w0 = __PKHBT(a01, ia01, 16);     // a0 | (255 - a0) << 16
+    const uint32_t w1 = __PKHTB(ia01, a01, 16);     // a1 | (255 - a1) << 16
+
+    return blend_channel(f, b, w0, w1, 11, 0x001F001Fu) |
+           blend_channel(f, b, w0, w1, 5, 0x003F003Fu) |
+           blend_channel(f, b, w0, w1, 0, 0x001F001Fu);
+}
+
+static inline uint32_t blend_load(const uint16_t* p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 16);
+}
+
+static inline void blend_store(uint16_t* p, uint32_t v)
+{
+    p[0] = (uint16_t)v;
+    p[1] = (uint16_t)(v >> 16);
+}
+
+// Blend one pair into dst; fully transparent and fully opaque pairs (most of a glyph or
+// an icon mask) skip the arithmetic, which gives the same result for them
+static inline void blend_put(uint16_t* dst, uint32_t f, uint32_t a01)
+{
+    if (a01 == 0u) return;
+    blend_store(dst, (a01 == 0x00FF00FFu) ? f : blend_pair(f, blend_load(dst), a01));
+}
+
+void BLEND_Colour(uint16_t* dst, uint16_t rgb565, uint8_t alpha, uint32_t n)
+{
+    const uint32_t f = (uint32_t)rgb565 * 0x00010001u;
+    const uint32_t a01 = (uint32_t)alpha * 0x00010001u;
+
+    uint32_t i = 0;
+    for (; i + 1u < n; i += 2u) blend_put(&dst[i], f, a01);
+    if (i < n) dst[i] = BLEND_Pixel(rgb565, dst[i], alpha);
+}
+
+void BLEND_ColourA8(uint16_t* dst, uint16_t rgb565, const uint8_t* alpha, uint32_t n)
+{
+    const uint32_t f = (uint32_t)rgb565 * 0x00010001u;
+
+    uint32_t i = 0;
+    for (; i + 1u < n; i += 2u) blend_put(&dst[i], f, (uint32_t)alpha[i] | ((uint32_t)alpha[i + 1u] << 16));
+    if (i < n) dst[i] = BLEND_Pixel(rgb565, dst[i], alpha[i]);
+}
+
+void BLEND_ImageA8(uint16_t* dst, const uint16_t* src, const uint8_t* alpha, uint32_t n)
+{
+    uint32_t i = 0;
+    for (; i + 1u < n; i += 2u)
+        blend_put(&dst[i], blend_load(&src[i]), (uint32_t)alpha[i] | ((uint32_t)alpha[i + 1u] << 16));
+    if (i < n) dst[i] = BLEND_Pixel(src[i], dst[i], alpha[i]);
+}
+
+void BLEND_ImageA4(uint16_t* dst, const uint16_t* src, const uint8_t* alpha4, uint32_t first, uint32_t n)
+{
+    if (n == 0u) return;
+
+    // Start on a byte of the mask
+    uint32_t i = 0;
+    if (first & 1u)
+    {
+        dst[0] = BLEND_Pixel(src[0], dst[0], blend_a4(alpha4, first));
+        i = 1;
+    }
+
+    const uint8_t* m = &alpha4[(first + i) >> 1];
+    for (; i + 1u < n; i += 2u, m++)
+    {
+        const uint32_t a01 = ((uint32_t)(*m & 0x0Fu) | ((uint32_t)(*m & 0xF0u) << 12)) * 17u;
+        blend_put(&dst[i], blend_load(&src[i]), a01);
+    }
+    if (i < n) dst[i] = BLEND_Pixel(src[i], dst[i], (uint8_t)((*m & 0x0Fu) * 17u));
+}
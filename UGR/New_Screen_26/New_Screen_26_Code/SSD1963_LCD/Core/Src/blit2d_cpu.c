@@ -0,0 +1,135 @@
+#include "blit2d.h"
+
+#include <string.h>
+
+// -----------------------------
+// Channel helpers
+// -----------------------------
+// Widen by replicating the top bits into the new low bits, like the DMA2D PFC does
+static inline uint32_t blit_r8(uint16_t c) { const uint32_t v = c >> 11; return (v << 3) | (v >> 2); }
+static inline uint32_t blit_g8(uint16_t c) { const uint32_t v = (c >> 5) & 0x3Fu; return (v << 2) | (v >> 4); }
+static inline uint32_t blit_b8(uint16_t c) { const uint32_t v = c & 0x1Fu; return (v << 3) | (v >> 2); }
+
+static inline uint16_t blit_pack565(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (uint16_t)(((r & 0xF8u) << 8) | ((g & 0xFCu) << 3) | (b >> 3));
+}
+
+// (f * a + b * (255 - a)) / 255, rounded, for 8-bit f, b and a
+static inline uint32_t blit_mix8(uint32_t f, uint32_t b, uint32_t a)
+{
+    const uint32_t v = f * a + b * (255u - a) + 128u;
+    return (v + (v >> 8)) >> 8;
+}
+
+static inline uint16_t blit_blend(uint32_t r, uint32_t g, uint32_t b, uint32_t a, uint16_t bg)
+{
+    if (a == 255u) return blit_pack565(r, g, b);
+    if (a == 0u) return bg;
+    return blit_pack565(blit_mix8(r, blit_r8(bg), a),
+                        blit_mix8(g, blit_g8(bg), a),
+                        blit_mix8(b, blit_b8(bg), a));
+}
+
+// -----------------------------
+// Operations
+// -----------------------------
+void BLIT_CpuFill(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t rgb565)
+{
+    for (uint32_t y = 0; y < h; y++, dst += dst_stride)
+    {
+        for (uint32_t x = 0; x < w; x++) dst[x] = rgb565;
+    }
+}
+
+void BLIT_CpuCopy(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                  uint16_t w, uint16_t h)
+{
+    for (uint32_t y = 0; y < h; y++, dst += dst_stride, src += src_stride)
+    {
+        memcpy(dst, src, (size_t)w * sizeof(uint16_t));
+    }
+}
+
+void BLIT_CpuBlendArgb8888(uint16_t* dst, uint16_t dst_stride, const uint32_t* src, uint16_t src_stride,
+                           uint16_t w, uint16_t h)
+{
+    for (uint32_t y = 0; y < h; y++, dst += dst_stride, src += src_stride)
+    {
+        for (uint32_t x = 0; x < w; x++)
+        {
+            const uint32_t s = src[x];
+            dst[x] = blit_blend((s >> 16) & 0xFFu, (s >> 8) & 0xFFu, s & 0xFFu, s >> 24, dst[x]);
+        }
+    }
+}
+
+void BLIT_CpuBlendArgb4444(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                           uint16_t w, uint16_t h)
+{
+    for (uint32_t y = 0; y < h; y++, dst += dst_stride, src += src_stride)
+    {
+        for (uint32_t x = 0; x < w; x++)
+        {
+            const uint32_t s = src[x];
+            dst[x] = blit_blend(((s >> 8) & 0xFu) * 17u, ((s >> 4) & 0xFu) * 17u, (s & 0xFu) * 17u,
+                                (s >> 12) * 17u, dst[x]);
+        }
+    }
+}
+
+void BLIT_CpuExpandL8(uint16_t* dst, uint16_t dst_stride, const uint8_t* src, uint16_t src_stride,
+                      uint16_t w, uint16_t h, const uint32_t* clut, uint16_t clut_size)
+{
+    // Convert the palette once; the per-pixel loop is then a plain lookup
+    uint16_t lut[256];
+    for (uint32_t i = 0; i < clut_size && i < 256u; i++)
+    {
+        lut[i] = blit_pack565((clut[i] >> 16) & 0xFFu, (clut[i] >> 8) & 0xFFu, clut[i] & 0xFFu);
+    }
+
+    for (uint32_t y = 0; y < h; y++, dst += dst_stride, src += src_stride)
+    {
+        for (uint32_t x = 0; x < w; x++) dst[x] = lut[src[x]];
+    }
+}
+
+// -----------------------------
+// Backend
+// -----------------------------
+#if BLIT_BACKEND == BLIT_BACKEND_CPU
+
+void BLIT_Fill(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t rgb565)
+{
+    BLIT_CpuFill(dst, dst_stride, w, h, rgb565);
+}
+
+void BLIT_Copy(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+               uint16_t w, uint16_t h)
+{
+    BLIT_CpuCopy(dst, dst_stride, src, src_stride, w, h);
+}
+
+void BLIT_BlendArgb8888(uint16_t* dst, uint16_t dst_stride, const uint32_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h)
+{
+    BLIT_CpuBlendArgb8888(dst, dst_stride, src, src_stride, w, h);
+}
+
+void BLIT_BlendArgb4444(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h)
+{
+    BLIT_CpuBlendArgb4444(dst, dst_stride, src, src_stride, w, h);
+}
+
+void BLIT_ExpandL8(uint16_t* dst, uint16_t dst_stride, const uint8_t* src, uint16_t src_stride,
+                   uint16_t w, uint16_t h, const uint32_t* clut, uint16_t clut_size)
+{
+    BLIT_CpuExpandL8(dst, dst_stride, src, src_stride, w, h, clut, clut_size);
+}
+
+void BLIT_Wait(void)
+{
+}
+
+#endif
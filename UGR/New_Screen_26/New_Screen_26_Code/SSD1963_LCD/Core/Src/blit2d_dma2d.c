@@ -0,0 +1,237 @@
+#include "blit2d.h"
+
+#if BLIT_BACKEND == BLIT_BACKEND_DMA2D
+
+#include "main.h"
+#include "memory_map.h"
+
+// The CubeMX driver set has no HAL DMA2D module, and the HAL one would cost a handle, a
+// lock and a status check per call for what is a dozen register writes, so the engine
+// is programmed directly. Transfers are polled on TCIF in BLIT_Wait; nothing here runs
+// in interrupt context.
+
+// -----------------------------
+// Register values
+// -----------------------------
+#define BLIT_MODE_M2M           0u
+#define BLIT_MODE_M2M_PFC       DMA2D_CR_MODE_0
+#define BLIT_MODE_M2M_BLEND     DMA2D_CR_MODE_1
+#define BLIT_MODE_R2M           (DMA2D_CR_MODE_0 | DMA2D_CR_MODE_1)
+
+#define BLIT_CM_ARGB8888        0u
+#define BLIT_CM_RGB565          2u
+#define BLIT_CM_ARGB4444        4u
+#define BLIT_CM_L8              5u
+
+#define BLIT_ISR_ERRORS         (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF | DMA2D_ISR_CAEIF)
+#define BLIT_IFCR_ALL           (DMA2D_IFCR_CTEIF | DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTWIF | \
+                                 DMA2D_IFCR_CAECIF | DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CCEIF)
+
+// Below SRAM1 is flash (write-through) or DTCM (never cached)
+#define BLIT_SRAM1_BASE         0x20020000UL
+
+// -----------------------------
+// State
+// -----------------------------
+static uint8_t blit_clock_on;
+static uint8_t blit_busy;
+static uint16_t* blit_dst;              // area the running transfer writes, for BLIT_Wait
+static uint32_t blit_dst_bytes;
+static const uint32_t* blit_clut;       // palette currently in the FG CLUT
+static uint16_t blit_clut_size;
+
+// -----------------------------
+// Cache maintenance
+// -----------------------------
+static inline uint8_t blit_cached(const void* p)
+{
+    const uint32_t a = (uint32_t)p;
+    if (a < BLIT_SRAM1_BASE) return 0;
+    return (a < MEM_DMA_WINDOW_BASE) || (a >= MEM_DMA_WINDOW_BASE + MEM_DMA_WINDOW_SIZE);
+}
+
+// Bytes from the first to the last pixel of a w x h area with the given stride
+static inline uint32_t blit_span(uint16_t stride, uint16_t w, uint16_t h, uint32_t pixel_size)
+{
+    return ((uint32_t)(h - 1u) * stride + w) * pixel_size;
+}
+
+static void blit_clean(const void* src, uint32_t bytes)
+{
+    if (blit_cached(src)) MEM_CleanDCache(src, bytes);
+}
+
+// -----------------------------
+// Transfers
+// -----------------------------
+void BLIT_Wait(void)
+{
+    if (!blit_busy) return;
+
+    uint32_t isr;
+    do
+    {
+        isr = DMA2D->ISR;
+    } while (!(isr & (DMA2D_ISR_TCIF | BLIT_ISR_ERRORS)));
+
+    DMA2D->IFCR = BLIT_IFCR_ALL;
+    blit_busy = 0;
+    if (isr & BLIT_ISR_ERRORS)
+    {
+        Error_Handler();
+    }
+
+    // The core may have speculatively refilled lines of dst while DMA2D wrote it
+    if (blit_cached(blit_dst)) MEM_InvalidateDCache(blit_dst, blit_dst_bytes);
+}
+
+// Output side of every operation: waits for the previous one, then points the output
+// at dst. Dirty lines over dst are written back now so they cannot be evicted on top
+// of what DMA2D writes.
+static void blit_begin(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h)
+{
+    BLIT_Wait();
+
+    if (!blit_clock_on)
+    {
+        __HAL_RCC_DMA2D_CLK_ENABLE();
+        blit_clock_on = 1;
+    }
+
+    blit_dst = dst;
+    blit_dst_bytes = blit_span(dst_stride, w, h, sizeof(uint16_t));
+    if (blit_cached(dst)) MEM_InvalidateDCache(dst, blit_dst_bytes);
+
+    DMA2D->OPFCCR = BLIT_CM_RGB565;
+    DMA2D->OMAR = (uint32_t)dst;
+    DMA2D->OOR = (uint32_t)(dst_stride - w);
+    DMA2D->NLR = ((uint32_t)w << 16) | h;
+}
+
+static void blit_start(uint32_t mode)
+{
+    blit_busy = 1;
+    DMA2D->CR = mode | DMA2D_CR_START;
+}
+
+static inline uint8_t blit_small(uint16_t w, uint16_t h)
+{
+    return (uint32_t)w * h < BLIT_DMA2D_MIN_PIXELS;
+}
+
+void BLIT_Fill(uint16_t* dst, uint16_t dst_stride, uint16_t w, uint16_t h, uint16_t rgb565)
+{
+    if (w == 0 || h == 0) return;
+    if (blit_small(w, h))
+    {
+        BLIT_Wait();
+        BLIT_CpuFill(dst, dst_stride, w, h, rgb565);
+        return;
+    }
+
+    blit_begin(dst, dst_stride, w, h);
+    DMA2D->OCOLR = rgb565;
+    blit_start(BLIT_MODE_R2M);
+}
+
+void BLIT_Copy(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+               uint16_t w, uint16_t h)
+{
+    if (w == 0 || h == 0) return;
+    if (blit_small(w, h))
+    {
+        BLIT_Wait();
+        BLIT_CpuCopy(dst, dst_stride, src, src_stride, w, h);
+        return;
+    }
+
+    blit_begin(dst, dst_stride, w, h);
+    blit_clean(src, blit_span(src_stride, w, h, sizeof(uint16_t)));
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = (uint32_t)(src_stride - w);
+    DMA2D->FGPFCCR = BLIT_CM_RGB565;
+    blit_start(BLIT_MODE_M2M);
+}
+
+// dst is both the background and the output, so the blend happens in place
+static void blit_blend(uint16_t* dst, uint16_t dst_stride, const void* src, uint16_t src_stride,
+                       uint16_t w, uint16_t h, uint32_t src_cm, uint32_t src_pixel_size)
+{
+    blit_begin(dst, dst_stride, w, h);
+    blit_clean(src, blit_span(src_stride, w, h, src_pixel_size));
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = (uint32_t)(src_stride - w);
+    DMA2D->FGPFCCR = src_cm;
+    DMA2D->BGMAR = (uint32_t)dst;
+    DMA2D->BGOR = (uint32_t)(dst_stride - w);
+    DMA2D->BGPFCCR = BLIT_CM_RGB565;
+    blit_start(BLIT_MODE_M2M_BLEND);
+}
+
+void BLIT_BlendArgb8888(uint16_t* dst, uint16_t dst_stride, const uint32_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h)
+{
+    if (w == 0 || h == 0) return;
+    if (blit_small(w, h))
+    {
+        BLIT_Wait();
+        BLIT_CpuBlendArgb8888(dst, dst_stride, src, src_stride, w, h);
+        return;
+    }
+    blit_blend(dst, dst_stride, src, src_stride, w, h, BLIT_CM_ARGB8888, sizeof(uint32_t));
+}
+
+void BLIT_BlendArgb4444(uint16_t* dst, uint16_t dst_stride, const uint16_t* src, uint16_t src_stride,
+                        uint16_t w, uint16_t h)
+{
+    if (w == 0 || h == 0) return;
+    if (blit_small(w, h))
+    {
+        BLIT_Wait();
+        BLIT_CpuBlendArgb4444(dst, dst_stride, src, src_stride, w, h);
+        return;
+    }
+    blit_blend(dst, dst_stride, src, src_stride, w, h, BLIT_CM_ARGB4444, sizeof(uint16_t));
+}
+
+void BLIT_ExpandL8(uint16_t* dst, uint16_t dst_stride, const uint8_t* src, uint16_t src_stride,
+                   uint16_t w, uint16_t h, const uint32_t* clut, uint16_t clut_size)
+{
+    if (w == 0 || h == 0 || clut_size == 0) return;
+    if (clut_size > 256u) clut_size = 256u;
+    if (blit_small(w, h))
+    {
+        BLIT_Wait();
+        BLIT_CpuExpandL8(dst, dst_stride, src, src_stride, w, h, clut, clut_size);
+        return;
+    }
+
+    blit_begin(dst, dst_stride, w, h);
+
+    const uint32_t pfc = BLIT_CM_L8 | ((uint32_t)(clut_size - 1u) << DMA2D_FGPFCCR_CS_Pos);
+
+    // Palettes are usually const and reused, so only a different one is loaded. Its
+    // contents are assumed not to change while it is current.
+    if (clut != blit_clut || clut_size != blit_clut_size)
+    {
+        blit_clean(clut, (uint32_t)clut_size * sizeof(uint32_t));
+        DMA2D->FGCMAR = (uint32_t)clut;
+        DMA2D->FGPFCCR = pfc | DMA2D_FGPFCCR_START;     // CCM 0: ARGB8888 entries
+        while (!(DMA2D->ISR & (DMA2D_ISR_CTCIF | DMA2D_ISR_CAEIF))) { }
+        if (DMA2D->ISR & DMA2D_ISR_CAEIF)
+        {
+            Error_Handler();
+        }
+        DMA2D->IFCR = DMA2D_IFCR_CCTCIF;
+        blit_clut = clut;
+        blit_clut_size = clut_size;
+    }
+
+    blit_clean(src, blit_span(src_stride, w, h, sizeof(uint8_t)));
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->FGOR = (uint32_t)(src_stride - w);
+    DMA2D->FGPFCCR = pfc;
+    blit_start(BLIT_MODE_M2M_PFC);
+}
+
+#endif
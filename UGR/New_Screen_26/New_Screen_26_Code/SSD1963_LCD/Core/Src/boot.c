@@ -0,0 +1,120 @@
+#include "boot.h"
+#include "main.h"
+#include "tim.h"
+#include "perf.h"
+#include "ssd1963.h"
+#include "ssd1963_gfx.h"
+#include "ssd1963_font.h"
+#include "fonts.h"
+
+#include <stdio.h>
+
+// -----------------------------
+// Timestamps
+// -----------------------------
+// Raw counter and clock per phase; BOOT_PhaseUs orders and converts them, so a mark from
+// SysTick never races one from main
+static uint32_t boot_cycles[BOOT_PHASE_COUNT];
+static uint32_t boot_hz[BOOT_PHASE_COUNT];
+static volatile uint8_t boot_reached[BOOT_PHASE_COUNT];
+
+static const char* const boot_names[BOOT_PHASE_COUNT] = {
+    "main", "hal", "clock", "panel start", "peripherals", "panel ready", "splash", "dash",
+};
+
+void BOOT_Start(void)
+{
+    PERF_Init();
+    BOOT_Mark(BOOT_PHASE_MAIN);
+}
+
+void BOOT_Mark(BOOT_Phase phase)
+{
+    boot_cycles[phase] = PERF_Cycles();
+    boot_hz[phase] = SystemCoreClock;
+    boot_reached[phase] = 1;
+}
+
+uint32_t BOOT_PhaseUs(BOOT_Phase phase)
+{
+    if (!boot_reached[phase] || !boot_reached[BOOT_PHASE_MAIN]) return 0;
+
+    // Walk the marks in time order up to phase, each interval at the clock it began with
+    uint64_t us = 0;
+    uint32_t at = boot_cycles[BOOT_PHASE_MAIN];
+    uint32_t hz = boot_hz[BOOT_PHASE_MAIN];
+    for (;;)
+    {
+        int32_t next = -1;
+        for (uint32_t p = 0; p < BOOT_PHASE_COUNT; p++)
+        {
+            if (!boot_reached[p] || boot_cycles[p] - at == 0u || boot_cycles[p] - at > boot_cycles[phase] - at)
+                continue;
+            if (next < 0 || boot_cycles[p] - at < boot_cycles[next] - at) next = (int32_t)p;
+        }
+        if (next < 0) break;
+
+        us += ((uint64_t)(boot_cycles[next] - at) * 1000000ULL) / hz;
+        at = boot_cycles[next];
+        hz = boot_hz[next];
+    }
+    return (uint32_t)us;
+}
+
+void BOOT_Print(void)
+{
+    for (uint32_t p = 0; p < BOOT_PHASE_COUNT; p++)
+    {
+        if (!boot_reached[p]) continue;
+        printf("boot %-12s %8lu us\n", boot_names[p], (unsigned long)BOOT_PhaseUs((BOOT_Phase)p));
+    }
+}
+
+// -----------------------------
+// Panel
+// -----------------------------
+static volatile uint8_t boot_panel_busy;
+
+void BOOT_PanelStart(void)
+{
+    SSD1963_InitStart();
+    BOOT_Mark(BOOT_PHASE_PANEL_START);
+    boot_panel_busy = 1;
+}
+
+void BOOT_Tick(void)
+{
+    if (boot_panel_busy && SSD1963_InitStep() == 0)
+    {
+        boot_panel_busy = 0;
+        BOOT_Mark(BOOT_PHASE_PANEL_READY);
+    }
+}
+
+#define BOOT_SPLASH_BG      RGB565(16, 16, 24)
+#define BOOT_SPLASH_FG      RGB565(255, 255, 255)
+#define BOOT_SPLASH_ACCENT  RGB565(255, 64, 0)
+#define BOOT_SPLASH_BAR_W   120
+
+void BOOT_Splash(void)
+{
+    while (!SSD1963_InitDone()) __WFI();
+
+    // The background streams by DMA; the text waits for it
+    SSD1963_FillAsync(BOOT_SPLASH_BG, NULL);
+
+    const char* title = "UGR";
+    const int16_t cy = SSD_VER_RESOLUTION / 2;
+    SSD1963_DrawText((int16_t)((SSD_HOR_RESOLUTION - SSD1963_TextWidth(&font_lato16, title)) / 2),
+                     (int16_t)(cy - font_lato16.line_height), &font_lato16, title, BOOT_SPLASH_FG, BOOT_SPLASH_BG);
+    SSD1963_FillRect((SSD_HOR_RESOLUTION - BOOT_SPLASH_BAR_W) / 2, (int16_t)(cy + 8), BOOT_SPLASH_BAR_W, 3,
+                     BOOT_SPLASH_ACCENT);
+
+    SSD1963_DisplayOn(1);
+
+    // Backlight PWM (external brightness control on PB15) at 50%, once there is a picture
+    HAL_TIM_PWM_Start(&htim12, TIM_CHANNEL_2);
+    __HAL_TIM_SET_COMPARE(&htim12, TIM_CHANNEL_2, __HAL_TIM_GET_AUTORELOAD(&htim12) / 2);
+
+    BOOT_Mark(BOOT_PHASE_SPLASH);
+}
@@ -21,6 +21,7 @@
 #include "can.h"
 
 /* USER CODE BEGIN 0 */
+#include "clock_profile.h"
 
 /* USER CODE END 0 */
 
@@ -54,6 +55,12 @@ void MX_CAN2_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN CAN2_Init 2 */
+  // The transmit scheduler relies on the controller retrying a frame that lost
+  // arbitration, so its place ahead of lower-priority mailboxes holds
+  hcan2.Init.AutoRetransmission = ENABLE;
+  // The generated timing is a 3-quantum bit sized for a 16 MHz PCLK1; solve prescaler
+  // and segments for CLK_CAN2_BITRATE at the running clock instead
+  CLK_ApplyCanTiming(&hcan2, CLK_CAN2_BITRATE);
 
   /* USER CODE END CAN2_Init 2 */
 
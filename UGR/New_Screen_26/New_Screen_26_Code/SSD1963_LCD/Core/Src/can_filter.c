@@ -0,0 +1,338 @@
+#include "can_filter.h"
+
+#include <stddef.h>
+#include <string.h>
+
+// Identifier register bits the filters compare (CAN_RIxR layout, and its 16-bit form)
+#define CANFLT_IDE32        0x04u
+#define CANFLT_RTR32        0x02u
+#define CANFLT_IDE16        0x08u
+#define CANFLT_RTR16        0x10u
+
+#define CANFLT_STD_BITS     11u
+#define CANFLT_EXT_BITS     29u
+
+// A block entry costs the space of two list entries of its width; take it when it
+// covers at least this many identifiers not yet covered
+#define CANFLT_BLOCK_MIN    3u
+
+typedef struct
+{
+    uint32_t key;
+    uint32_t rate;
+} canflt_Sub;
+
+// One list or mask entry: the identifiers whose care bits equal value's
+typedef struct
+{
+    uint32_t value;         // identifier, without CANFLT_EXT
+    uint32_t care;
+    uint32_t weight;
+    uint32_t ids;
+} canflt_Entry;
+
+static canflt_Sub canflt_subs[CANFLT_MAX_IDS];
+static uint8_t canflt_covered[CANFLT_MAX_IDS];
+static uint32_t canflt_nsubs;
+
+// -----------------------------
+// Subscribed set
+// -----------------------------
+static int32_t canflt_find(uint32_t key)
+{
+    uint32_t lo = 0, hi = canflt_nsubs;
+    while (lo < hi)
+    {
+        const uint32_t mid = (lo + hi) / 2u;
+        if (canflt_subs[mid].key < key) lo = mid + 1u;
+        else hi = mid;
+    }
+    return (lo < canflt_nsubs && canflt_subs[lo].key == key) ? (int32_t)lo : -1;
+}
+
+static uint32_t canflt_popcount(uint32_t v)
+{
+    uint32_t n = 0;
+    for (; v; v &= v - 1u) n++;
+    return n;
+}
+
+// Whether every identifier that matches base on the bits outside free is subscribed
+static uint8_t canflt_block_in(uint32_t base, uint32_t free, uint32_t ext, uint32_t group)
+{
+    if ((1ull << canflt_popcount(free)) > group) return 0;
+
+    uint32_t sub = 0;
+    do
+    {
+        if (canflt_find((base | sub) | ext) < 0) return 0;
+        sub = (sub - free) & free;
+    } while (sub != 0u);
+    return 1;
+}
+
+// Largest block around key inside the set, freeing low bits first so that runs of
+// consecutive identifiers become aligned ranges
+static uint32_t canflt_grow(uint32_t key, uint32_t width, uint32_t ext, uint32_t group)
+{
+    const uint32_t id = key & ~CANFLT_EXT;
+    uint32_t free = 0;
+    for (uint32_t b = 0; b < width; b++)
+    {
+        const uint32_t trial = free | (1u << b);
+        if (canflt_block_in(id & ~trial, trial, ext, group)) free = trial;
+    }
+    return free;
+}
+
+// Splits subs[lo, hi) (one identifier width) into block and single entries
+static void canflt_cover(uint32_t lo, uint32_t hi, uint32_t width, uint32_t ext,
+                         canflt_Entry* blocks, uint32_t* nblocks, canflt_Entry* singles, uint32_t* nsingles)
+{
+    const uint32_t all = (1u << width) - 1u;
+
+    for (uint32_t i = lo; i < hi; i++)
+    {
+        if (canflt_covered[i]) continue;
+
+        const uint32_t free = canflt_grow(canflt_subs[i].key, width, ext, hi - lo);
+        const uint32_t base = canflt_subs[i].key & ~CANFLT_EXT & ~free;
+
+        uint32_t fresh = 0, weight = 0, sub = 0;
+        do
+        {
+            const int32_t k = canflt_find((base | sub) | ext);
+            if (!canflt_covered[k])
+            {
+                fresh++;
+                weight += canflt_subs[k].rate;
+            }
+            sub = (sub - free) & free;
+        } while (sub != 0u);
+
+        if (fresh >= CANFLT_BLOCK_MIN)
+        {
+            blocks[(*nblocks)++] = (canflt_Entry){ base, all & ~free, weight, fresh };
+            sub = 0;
+            do
+            {
+                canflt_covered[canflt_find((base | sub) | ext)] = 1;
+                sub = (sub - free) & free;
+            } while (sub != 0u);
+        }
+        else
+        {
+            singles[(*nsingles)++] = (canflt_Entry){ canflt_subs[i].key & ~CANFLT_EXT, all, canflt_subs[i].rate, 1 };
+            canflt_covered[i] = 1;
+        }
+    }
+}
+
+// -----------------------------
+// Register encoding
+// -----------------------------
+static uint32_t canflt_id32(uint32_t id, uint32_t ext)
+{
+    return ext ? ((id << 3) | CANFLT_IDE32) : (id << 21);
+}
+
+static uint32_t canflt_mask32(uint32_t care, uint32_t ext)
+{
+    return (ext ? (care << 3) : (care << 21)) | CANFLT_IDE32 | CANFLT_RTR32;
+}
+
+static uint32_t canflt_id16(uint32_t id)
+{
+    return id << 5;
+}
+
+static uint32_t canflt_mask16(uint32_t care)
+{
+    return (care << 5) | CANFLT_IDE16 | CANFLT_RTR16;
+}
+
+static CANFLT_Bank* canflt_bank(CANFLT_Plan* plan, CANFLT_Mode mode)
+{
+    if (plan->count >= CANFLT_BANKS) return NULL;
+    CANFLT_Bank* b = &plan->bank[plan->count++];
+    memset(b, 0, sizeof(*b));
+    b->mode = (uint8_t)mode;
+    return b;
+}
+
+// Entry slot of a bank; unused list slots repeat the first entry, which changes nothing
+static void canflt_put(CANFLT_Bank* b, uint32_t slot, const canflt_Entry* e, uint32_t ext)
+{
+    switch ((CANFLT_Mode)b->mode)
+    {
+    case CANFLT_LIST16:
+    {
+        const uint32_t v = canflt_id16(e->value);
+        if (slot == 0u) b->fr1 = b->fr2 = v * 0x00010001u;
+        else if (slot == 1u) b->fr1 = (b->fr1 & 0xFFFFu) | (v << 16);
+        else if (slot == 2u) b->fr2 = (b->fr2 & 0xFFFF0000u) | v;
+        else b->fr2 = (b->fr2 & 0xFFFFu) | (v << 16);
+        break;
+    }
+    case CANFLT_MASK16:
+    {
+        const uint32_t pair = canflt_id16(e->value) | (canflt_mask16(e->care) << 16);
+        if (slot == 0u) b->fr1 = b->fr2 = pair;
+        else b->fr2 = pair;
+        break;
+    }
+    case CANFLT_LIST32:
+        if (slot == 0u) b->fr1 = b->fr2 = canflt_id32(e->value, ext);
+        else b->fr2 = canflt_id32(e->value, ext);
+        break;
+    case CANFLT_MASK32:
+        b->fr1 = canflt_id32(e->value, ext);
+        b->fr2 = canflt_mask32(e->care, ext);
+        break;
+    }
+    b->weight += e->weight;
+    b->ids = (uint8_t)(b->ids + e->ids);
+}
+
+// Puts entries [0, n) into banks of mode, per to a bank; returns the free slots left in
+// the last one
+static uint32_t canflt_pack(CANFLT_Plan* plan, CANFLT_Mode mode, uint32_t per, const canflt_Entry* e,
+                            uint32_t n, uint32_t ext, CANFLT_Bank** last, uint8_t* full)
+{
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < n; i++, slot = (slot + 1u) % per)
+    {
+        if (slot == 0u && (*last = canflt_bank(plan, mode)) == NULL)
+        {
+            *full = 1;
+            return 0;
+        }
+        canflt_put(*last, slot, &e[i], ext);
+    }
+    return slot ? per - slot : 0;
+}
+
+// -----------------------------
+// Planning
+// -----------------------------
+uint32_t CANFLT_Build(CANFLT_Plan* plan, const uint32_t* keys, uint32_t n, const uint16_t* rates)
+{
+    static canflt_Entry std_blocks[CANFLT_MAX_IDS], std_singles[CANFLT_MAX_IDS];
+    static canflt_Entry ext_blocks[CANFLT_MAX_IDS], ext_singles[CANFLT_MAX_IDS];
+
+    memset(plan, 0, sizeof(*plan));
+    if (n == 0u || n > CANFLT_MAX_IDS) return 0;
+
+    // Sorted and unique (standard keys first), a repeated key keeping its highest rate
+    canflt_nsubs = 0;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const uint32_t key = (keys[i] & CANFLT_EXT) ? keys[i] & (CANFLT_EXT | 0x1FFFFFFFu) : keys[i] & 0x7FFu;
+        const uint32_t rate = rates ? rates[i] : 1u;
+        uint32_t at = canflt_nsubs;
+        while (at > 0u && canflt_subs[at - 1u].key > key) at--;
+        if (at > 0u && canflt_subs[at - 1u].key == key)
+        {
+            if (rate > canflt_subs[at - 1u].rate) canflt_subs[at - 1u].rate = rate;
+            continue;
+        }
+        memmove(&canflt_subs[at + 1u], &canflt_subs[at], (canflt_nsubs - at) * sizeof(canflt_Sub));
+        canflt_subs[at] = (canflt_Sub){ key, rate };
+        canflt_nsubs++;
+    }
+    memset(canflt_covered, 0, sizeof(canflt_covered));
+
+    uint32_t nstd = 0;
+    while (nstd < canflt_nsubs && !(canflt_subs[nstd].key & CANFLT_EXT)) nstd++;
+
+    uint32_t nsb = 0, nss = 0, nxb = 0, nxs = 0;
+    canflt_cover(0, nstd, CANFLT_STD_BITS, 0, std_blocks, &nsb, std_singles, &nss);
+    canflt_cover(nstd, canflt_nsubs, CANFLT_EXT_BITS, CANFLT_EXT, ext_blocks, &nxb, ext_singles, &nxs);
+
+    // Widest entries first; the last 32-bit list and 16-bit mask banks may keep a slot
+    // free, which takes a standard identifier before another 16-bit list bank is opened
+    CANFLT_Bank* list32 = NULL;
+    CANFLT_Bank* mask16 = NULL;
+    CANFLT_Bank* last = NULL;
+    uint8_t full = 0;
+    canflt_pack(plan, CANFLT_MASK32, 1, ext_blocks, nxb, 1, &last, &full);
+    const uint32_t list32_free = canflt_pack(plan, CANFLT_LIST32, 2, ext_singles, nxs, 1, &list32, &full);
+    const uint32_t mask16_free = canflt_pack(plan, CANFLT_MASK16, 2, std_blocks, nsb, 0, &mask16, &full);
+
+    uint32_t rest = nss % 4u;
+    if (rest > 0u && mask16_free)
+    {
+        canflt_put(mask16, 1, &std_singles[--nss], 0);
+        rest--;
+    }
+    if (rest > 0u && list32_free)
+    {
+        canflt_put(list32, 1, &std_singles[--nss], 0);
+        rest--;
+    }
+    canflt_pack(plan, CANFLT_LIST16, 4, std_singles, nss, 0, &last, &full);
+    if (full) return 0;
+
+    // Heaviest bank first onto the lighter FIFO
+    uint8_t order[CANFLT_BANKS];
+    for (uint32_t i = 0; i < plan->count; i++)
+    {
+        uint32_t at = i;
+        while (at > 0u && plan->bank[order[at - 1u]].weight < plan->bank[i].weight)
+        {
+            order[at] = order[at - 1u];
+            at--;
+        }
+        order[at] = (uint8_t)i;
+    }
+    for (uint32_t i = 0; i < plan->count; i++)
+    {
+        CANFLT_Bank* b = &plan->bank[order[i]];
+        b->fifo = (plan->fifo_weight[1] < plan->fifo_weight[0]) ? 1u : 0u;
+        plan->fifo_weight[b->fifo] += b->weight;
+    }
+    return plan->count;
+}
+
+// -----------------------------
+// Matching
+// -----------------------------
+uint8_t CANFLT_Match(const CANFLT_Plan* plan, uint32_t key, uint8_t remote, uint8_t* fifo)
+{
+    const uint32_t ext = key & CANFLT_EXT;
+    const uint32_t id = key & (ext ? 0x1FFFFFFFu : 0x7FFu);
+
+    // The received identifier as the 32-bit filters see it, and as the 16-bit ones do
+    const uint32_t w32 = canflt_id32(id, ext) | (remote ? CANFLT_RTR32 : 0u);
+    const uint32_t w16 = ext ? (((id >> 18) << 5) | CANFLT_IDE16 | ((id >> 15) & 7u)) : (id << 5);
+    const uint32_t r16 = w16 | (remote ? CANFLT_RTR16 : 0u);
+
+    for (uint32_t i = 0; i < plan->count; i++)
+    {
+        const CANFLT_Bank* b = &plan->bank[i];
+        uint8_t hit = 0;
+        switch ((CANFLT_Mode)b->mode)
+        {
+        case CANFLT_LIST16:
+            hit = r16 == (b->fr1 & 0xFFFFu) || r16 == (b->fr1 >> 16) ||
+                  r16 == (b->fr2 & 0xFFFFu) || r16 == (b->fr2 >> 16);
+            break;
+        case CANFLT_MASK16:
+            hit = ((r16 ^ b->fr1) & (b->fr1 >> 16) & 0xFFFFu) == 0u ||
+                  ((r16 ^ b->fr2) & (b->fr2 >> 16) & 0xFFFFu) == 0u;
+            break;
+        case CANFLT_LIST32:
+            hit = w32 == b->fr1 || w32 == b->fr2;
+            break;
+        case CANFLT_MASK32:
+            hit = ((w32 ^ b->fr1) & b->fr2) == 0u;
+            break;
+        }
+        if (hit)
+        {
+            if (fifo) *fifo = b->fifo;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include "can_rx.h"
+#include "main.h"
+#include "perf.h"
+
+#include <stdio.h>
+#include <string.h>
+
+_Static_assert((CANRX_RING_SIZE & (CANRX_RING_SIZE - 1u)) == 0u, "CANRX_RING_SIZE must be a power of two");
+_Static_assert(sizeof(CANRX_Frame) == 24u, "CANRX_Frame layout");
+
+// -----------------------------
+// Ring
+// -----------------------------
+// Free-running indices, masked on access: head - tail is the fill level even across
+// wrap-around. head is written only by the receive interrupts, tail only by the main loop.
+static CANRX_Frame canrx_ring[CANRX_RING_SIZE];
+static volatile uint32_t canrx_head;
+static volatile uint32_t canrx_tail;
+static CANRX_Stats canrx_stats;
+
+// -----------------------------
+// Producer (CAN2_RX0 / CAN2_RX1)
+// -----------------------------
+// Straight from the FIFO output mailbox into the ring slot; HAL_CAN_GetRxMessage would go
+// through a header struct and a second copy for every frame.
+static void canrx_drain(CAN_TypeDef* can, uint32_t fifo)
+{
+    __IO uint32_t* rfr = fifo ? &can->RF1R : &can->RF0R;
+    const CAN_FIFOMailBox_TypeDef* mb = &can->sFIFOMailBox[fifo];
+
+    // FMP and RFOM sit at the same bits in RF0R and RF1R
+    while (*rfr & CAN_RF0R_FMP0)
+    {
+        const uint32_t head = canrx_head;
+        const uint32_t used = head - canrx_tail;
+
+        if (used >= CANRX_RING_SIZE)
+        {
+            canrx_stats.ring_full++;
+        }
+        else
+        {
+            CANRX_Frame* f = &canrx_ring[head & (CANRX_RING_SIZE - 1u)];
+            const uint32_t rir = mb->RIR;
+            const uint32_t rdtr = mb->RDTR;
+            const uint32_t lo = mb->RDLR;
+            const uint32_t hi = mb->RDHR;
+
+            f->cycles = PERF_Cycles();
+            f->tick = HAL_GetTick();
+            f->id = (rir & CAN_RI0R_IDE) ? (rir >> CAN_RI0R_EXID_Pos) : (rir >> CAN_RI0R_STID_Pos);
+            f->flags = (uint8_t)(((rir & CAN_RI0R_IDE) ? CANRX_EXT : 0u) |
+                                 ((rir & CAN_RI0R_RTR) ? CANRX_RTR : 0u) |
+                                 (fifo ? CANRX_FIFO1 : 0u));
+            f->dlc = (uint8_t)((rdtr & CAN_RDT0R_DLC) >> CAN_RDT0R_DLC_Pos);
+            f->filter = (uint8_t)((rdtr & CAN_RDT0R_FMI) >> CAN_RDT0R_FMI_Pos);
+            memcpy(&f->data[0], &lo, 4);
+            memcpy(&f->data[4], &hi, 4);
+
+            // The slot must be complete before the consumer can see it
+            __DMB();
+            canrx_head = head + 1u;
+
+            canrx_stats.received++;
+            if (used + 1u > canrx_stats.peak) canrx_stats.peak = used + 1u;
+        }
+
+        *rfr = CAN_RF0R_RFOM0;
+    }
+}
+
+void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef* hcan)
+{
+    canrx_drain(hcan->Instance, 0);
+}
+
+void HAL_CAN_RxFifo1MsgPendingCallback(CAN_HandleTypeDef* hcan)
+{
+    canrx_drain(hcan->Instance, 1);
+}
+
+void HAL_CAN_ErrorCallback(CAN_HandleTypeDef* hcan)
+{
+    if (hcan->ErrorCode & HAL_CAN_ERROR_RX_FOV0) canrx_stats.fifo_overrun++;
+    if (hcan->ErrorCode & HAL_CAN_ERROR_RX_FOV1) canrx_stats.fifo_overrun++;
+    HAL_CAN_ResetError(hcan);
+}
+
+// -----------------------------
+// Consumer (main loop)
+// -----------------------------
+uint32_t CANRX_Peek(const CANRX_Frame** frames)
+{
+    const uint32_t tail = canrx_tail;
+    uint32_t n = canrx_head - tail;
+    // Slots are read only after the head that published them
+    __DMB();
+
+    const uint32_t at = tail & (CANRX_RING_SIZE - 1u);
+    if (n > CANRX_RING_SIZE - at) n = CANRX_RING_SIZE - at;
+    *frames = &canrx_ring[at];
+    return n;
+}
+
+void CANRX_Release(uint32_t n)
+{
+    // Done reading the slots before the producer may reuse them
+    __DMB();
+    canrx_tail = canrx_tail + n;
+}
+
+void CANRX_GetStats(CANRX_Stats* stats)
+{
+    *stats = canrx_stats;
+}
+
+void CANRX_Print(void)
+{
+    CANRX_Stats s;
+    CANRX_GetStats(&s);
+    printf("can rx: %lu frames, %lu dropped (ring full), %lu fifo overruns, peak %lu/%u\n",
+           (unsigned long)s.received, (unsigned long)s.ring_full, (unsigned long)s.fifo_overrun,
+           (unsigned long)s.peak, (unsigned)CANRX_RING_SIZE);
+}
+
+// -----------------------------
+// Start
+// -----------------------------
+// Without a plan: CAN2 owns the filter banks from here up (the banks live in CAN1)
+#define CANRX_FIRST_BANK    14u
+// Lowest standard-ID bit, as it sits in a 32-bit filter's high halfword
+#define CANRX_STID_LSB      ((1u << CAN_RI0R_STID_Pos) >> 16)
+
+// The planned banks, all of them given to CAN2 (CAN1 is unused)
+static void canrx_filters_planned(CAN_HandleTypeDef* hcan, const CANFLT_Plan* plan)
+{
+    for (uint32_t i = 0; i < plan->count; i++)
+    {
+        const CANFLT_Bank* b = &plan->bank[i];
+        const uint8_t wide = (b->mode == CANFLT_LIST32 || b->mode == CANFLT_MASK32);
+
+        // HAL_CAN_ConfigFilter packs the halves differently per scale
+        CAN_FilterTypeDef filter = {0};
+        filter.FilterBank = i;
+        filter.FilterMode = (b->mode == CANFLT_LIST16 || b->mode == CANFLT_LIST32) ? CAN_FILTERMODE_IDLIST
+                                                                                    : CAN_FILTERMODE_IDMASK;
+        filter.FilterScale = wide ? CAN_FILTERSCALE_32BIT : CAN_FILTERSCALE_16BIT;
+        filter.FilterIdHigh = wide ? (b->fr1 >> 16) : (b->fr2 & 0xFFFFu);
+        filter.FilterIdLow = b->fr1 & 0xFFFFu;
+        filter.FilterMaskIdHigh = b->fr2 >> 16;
+        filter.FilterMaskIdLow = wide ? (b->fr2 & 0xFFFFu) : (b->fr1 >> 16);
+        filter.FilterFIFOAssignment = b->fifo ? CAN_FILTER_FIFO1 : CAN_FILTER_FIFO0;
+        filter.FilterActivation = CAN_FILTER_ENABLE;
+        filter.SlaveStartFilterBank = 0;
+        if (HAL_CAN_ConfigFilter(hcan, &filter) != HAL_OK) Error_Handler();
+    }
+}
+
+// Everything accepted, split on the lowest standard-ID bit so both FIFOs take a share:
+// six hardware slots instead of three if the interrupts are ever held off
+static void canrx_filters_open(CAN_HandleTypeDef* hcan)
+{
+    CAN_FilterTypeDef filter = {0};
+    filter.FilterMode = CAN_FILTERMODE_IDMASK;
+    filter.FilterScale = CAN_FILTERSCALE_32BIT;
+    filter.FilterMaskIdHigh = CANRX_STID_LSB;
+    filter.FilterActivation = CAN_FILTER_ENABLE;
+    filter.SlaveStartFilterBank = CANRX_FIRST_BANK;
+
+    filter.FilterBank = CANRX_FIRST_BANK;
+    filter.FilterIdHigh = 0;
+    filter.FilterFIFOAssignment = CAN_FILTER_FIFO0;
+    if (HAL_CAN_ConfigFilter(hcan, &filter) != HAL_OK) Error_Handler();
+
+    filter.FilterBank = CANRX_FIRST_BANK + 1u;
+    filter.FilterIdHigh = CANRX_STID_LSB;
+    filter.FilterFIFOAssignment = CAN_FILTER_FIFO1;
+    if (HAL_CAN_ConfigFilter(hcan, &filter) != HAL_OK) Error_Handler();
+}
+
+void CANRX_Start(CAN_HandleTypeDef* hcan, const CANFLT_Plan* plan)
+{
+    // A single producer needs both receive interrupts at one preemption level
+    if (NVIC_GetPriority(CAN2_RX0_IRQn) != NVIC_GetPriority(CAN2_RX1_IRQn)) Error_Handler();
+
+    if (plan && plan->count) canrx_filters_planned(hcan, plan);
+    else canrx_filters_open(hcan);
+
+    if (HAL_CAN_Start(hcan) != HAL_OK) Error_Handler();
+    if (HAL_CAN_ActivateNotification(hcan, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_RX_FIFO1_MSG_PENDING |
+                                               CAN_IT_RX_FIFO0_OVERRUN | CAN_IT_RX_FIFO1_OVERRUN) != HAL_OK)
+        Error_Handler();
+}
@@ -0,0 +1,278 @@
+#include "can_sched.h"
+
+#include <string.h>
+
+_Static_assert(CANSCHED_QUEUE_SIZE + CANSCHED_PERIODIC_MAX < CANSCHED_NONE, "heap refs must fit a byte");
+
+// -----------------------------
+// Heap
+// -----------------------------
+static inline uint8_t cansched_before(const CANSCHED_Entry* a, const CANSCHED_Entry* b)
+{
+    return a->key < b->key || (a->key == b->key && (int32_t)(a->seq - b->seq) < 0);
+}
+
+static void cansched_push(CANSCHED_State* s, CANSCHED_Entry e)
+{
+    uint32_t i = s->count++;
+    while (i > 0u)
+    {
+        const uint32_t parent = (i - 1u) / 2u;
+        if (!cansched_before(&e, &s->heap[parent])) break;
+        s->heap[i] = s->heap[parent];
+        i = parent;
+    }
+    s->heap[i] = e;
+    if (s->count > s->stats.peak) s->stats.peak = s->count;
+}
+
+// Takes out the entry at i, filling the hole from the end of the heap
+static CANSCHED_Entry cansched_remove(CANSCHED_State* s, uint32_t i)
+{
+    const CANSCHED_Entry out = s->heap[i];
+    const CANSCHED_Entry last = s->heap[--s->count];
+    if (i == s->count) return out;
+
+    while (i > 0u && cansched_before(&last, &s->heap[(i - 1u) / 2u]))
+    {
+        s->heap[i] = s->heap[(i - 1u) / 2u];
+        i = (i - 1u) / 2u;
+    }
+    for (;;)
+    {
+        uint32_t child = 2u * i + 1u;
+        if (child >= s->count) break;
+        if (child + 1u < s->count && cansched_before(&s->heap[child + 1u], &s->heap[child])) child++;
+        if (!cansched_before(&s->heap[child], &last)) break;
+        s->heap[i] = s->heap[child];
+        i = child;
+    }
+    s->heap[i] = last;
+    return out;
+}
+
+static inline CANSCHED_Entry cansched_pop(CANSCHED_State* s)
+{
+    return cansched_remove(s, 0);
+}
+
+static inline const CANSCHED_Frame* cansched_frame(const CANSCHED_State* s, uint8_t ref)
+{
+    return (ref < CANSCHED_QUEUE_SIZE) ? &s->pool[ref] : &s->periodic[ref - CANSCHED_QUEUE_SIZE].frame;
+}
+
+// -----------------------------
+// Queueing
+// -----------------------------
+void CANSCHED_Init(CANSCHED_State* s, uint8_t fifo_order)
+{
+    memset(s, 0, sizeof(*s));
+    for (uint32_t i = 0; i < CANSCHED_QUEUE_SIZE; i++) s->free[i] = (uint8_t)i;
+    s->free_count = CANSCHED_QUEUE_SIZE;
+    s->fifo_order = fifo_order ? 1u : 0u;
+}
+
+// The lowest-priority waiting one-shot frame (the newest on a tie), if it ranks below key
+static uint32_t cansched_victim(const CANSCHED_State* s, uint32_t key)
+{
+    uint32_t victim = CANSCHED_NONE;
+    for (uint32_t i = 0; i < s->count; i++)
+    {
+        const CANSCHED_Entry* e = &s->heap[i];
+        if (e->ref >= CANSCHED_QUEUE_SIZE || e->key <= key) continue;
+        if (victim == CANSCHED_NONE || cansched_before(&s->heap[victim], e)) victim = i;
+    }
+    return victim;
+}
+
+uint8_t CANSCHED_Queue(CANSCHED_State* s, const CANSCHED_Frame* frame)
+{
+    const uint32_t key = CANSCHED_Key(frame->id, frame->flags);
+    uint8_t ref;
+
+    if (s->free_count)
+    {
+        ref = s->free[--s->free_count];
+    }
+    else
+    {
+        // Full: a frame that outranks something waiting takes its place, so low-priority
+        // traffic can never lock out a high-priority frame
+        const uint32_t victim = cansched_victim(s, key);
+        s->stats.dropped++;
+        if (victim == CANSCHED_NONE) return 0;
+        ref = cansched_remove(s, victim).ref;
+    }
+
+    s->pool[ref] = *frame;
+    cansched_push(s, (CANSCHED_Entry){ .key = key, .seq = s->seq++, .ref = ref });
+    s->stats.queued++;
+    return 1;
+}
+
+uint8_t CANSCHED_AddPeriodic(CANSCHED_State* s, uint32_t id, uint8_t flags, uint8_t dlc, uint16_t period_ms,
+                             uint16_t jitter_ms, uint32_t now)
+{
+    if (s->periodic_count >= CANSCHED_PERIODIC_MAX || period_ms == 0u || jitter_ms >= period_ms || dlc > 8u)
+        return CANSCHED_NONE;
+
+    const uint32_t slot = s->periodic_count++;
+    CANSCHED_Periodic* p = &s->periodic[slot];
+    memset(p, 0, sizeof(*p));
+    p->frame.id = id;
+    p->frame.flags = flags;
+    p->frame.dlc = dlc;
+    p->period_ms = period_ms;
+    p->jitter_ms = jitter_ms;
+    p->due = now;
+    return (uint8_t)slot;
+}
+
+void CANSCHED_SetData(CANSCHED_State* s, uint8_t slot, const uint8_t* data, uint8_t dlc)
+{
+    if (slot >= s->periodic_count || dlc > 8u) return;
+    CANSCHED_Frame* f = &s->periodic[slot].frame;
+    memcpy(f->data, data, dlc);
+    f->dlc = dlc;
+}
+
+uint32_t CANSCHED_Tick(CANSCHED_State* s, uint32_t now)
+{
+    uint32_t released = 0;
+    for (uint32_t i = 0; i < s->periodic_count; i++)
+    {
+        CANSCHED_Periodic* p = &s->periodic[i];
+        if ((int32_t)(now - p->due) < 0) continue;
+
+        if (p->pending)
+        {
+            p->skipped++;
+        }
+        else
+        {
+            p->pending = 1;
+            p->released = p->due;
+            cansched_push(s, (CANSCHED_Entry){ .key = CANSCHED_Key(p->frame.id, p->frame.flags), .seq = s->seq++,
+                                               .ref = (uint8_t)(CANSCHED_QUEUE_SIZE + i) });
+            released++;
+        }
+
+        // Nominal schedule; whole periods missed (the tick held off) are skipped, not replayed
+        p->due += p->period_ms;
+        if ((int32_t)(now - p->due) >= 0)
+        {
+            const uint32_t behind = (now - p->due) / p->period_ms + 1u;
+            p->skipped += behind;
+            p->due += behind * p->period_ms;
+        }
+    }
+    return released;
+}
+
+// -----------------------------
+// Mailboxes
+// -----------------------------
+uint8_t CANSCHED_Next(CANSCHED_State* s, uint8_t free, CANSCHED_Frame* out)
+{
+    free &= (uint8_t)~s->loaded & ((1u << CANSCHED_MAILBOXES) - 1u);
+    if (s->count == 0u || free == 0u) return CANSCHED_NONE;
+
+    // With identifier priority the bxCAN breaks a tie between equal identifiers by mailbox
+    // number, which could send them out of order; the next one waits for the first. With
+    // FIFO priority the top must not queue up behind a frame it outranks (Preempt takes
+    // those out first; one already on the wire goes ahead either way), nor go ahead of an
+    // aborting frame that comes back in front of it.
+    const uint32_t key = s->heap[0].key;
+    for (uint32_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+    {
+        const uint8_t bit = (uint8_t)(1u << mb);
+        if (!(s->loaded & bit)) continue;
+        const uint32_t held = s->mailbox[mb].key;
+        if (s->fifo_order ? ((s->aborting & bit) ? held <= key : held > key) : held == key) return CANSCHED_NONE;
+    }
+
+    const uint8_t mb = (uint8_t)__builtin_ctz(free);
+    s->mailbox[mb] = cansched_pop(s);
+    s->loaded |= (uint8_t)(1u << mb);
+    *out = *cansched_frame(s, s->mailbox[mb].ref);
+    return mb;
+}
+
+uint8_t CANSCHED_Preempt(CANSCHED_State* s, uint8_t free)
+{
+    if (s->count == 0u) return 0;
+    const uint32_t key = s->heap[0].key;
+
+    uint8_t abort = 0;
+    if (s->fifo_order)
+    {
+        // Requests leave in the order they were made: everything loaded ahead of the top
+        // that it outranks has to come out
+        for (uint32_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+        {
+            const uint8_t bit = (uint8_t)(1u << mb);
+            if ((s->loaded & bit) && !(s->aborting & bit) && s->mailbox[mb].key > key) abort |= bit;
+        }
+    }
+    else
+    {
+        // A free mailbox lets the top compete on its own; otherwise make room by taking out
+        // the lowest-priority frame if the top outranks it
+        if (free & (uint8_t)~s->loaded & ((1u << CANSCHED_MAILBOXES) - 1u)) return 0;
+
+        uint32_t worst = CANSCHED_NONE;
+        for (uint32_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+        {
+            const uint8_t bit = (uint8_t)(1u << mb);
+            if (!(s->loaded & bit)) continue;
+            if (s->aborting & bit) return 0;    // room is already being made
+            if (worst == CANSCHED_NONE || s->mailbox[mb].key > s->mailbox[worst].key) worst = mb;
+        }
+        if (worst != CANSCHED_NONE && s->mailbox[worst].key > key) abort = (uint8_t)(1u << worst);
+    }
+
+    s->aborting |= abort;
+    s->stats.preempted += (uint32_t)__builtin_popcount(abort);
+    return abort;
+}
+
+void CANSCHED_Done(CANSCHED_State* s, uint8_t mailbox, uint8_t sent, uint32_t now)
+{
+    if (mailbox >= CANSCHED_MAILBOXES || !(s->loaded & (1u << mailbox))) return;
+    const uint8_t bit = (uint8_t)(1u << mailbox);
+
+    const CANSCHED_Entry e = s->mailbox[mailbox];
+    s->loaded &= (uint8_t)~bit;
+    s->aborting &= (uint8_t)~bit;
+
+    // Aborted before it reached the bus: back in its old place
+    if (!sent)
+    {
+        cansched_push(s, e);
+        return;
+    }
+
+    s->stats.sent++;
+    if (e.ref < CANSCHED_QUEUE_SIZE)
+    {
+        s->free[s->free_count++] = e.ref;
+        return;
+    }
+
+    CANSCHED_Periodic* p = &s->periodic[e.ref - CANSCHED_QUEUE_SIZE];
+    const uint32_t lag = now - p->released;
+    p->pending = 0;
+    p->sent++;
+    if (lag > p->jitter_ms) p->late++;
+    if (lag > p->worst_ms) p->worst_ms = lag;
+}
+
+void CANSCHED_Settle(CANSCHED_State* s, uint8_t empty, uint32_t now)
+{
+    for (uint8_t lost = empty & s->loaded; lost; lost &= (uint8_t)(lost - 1u))
+    {
+        const uint8_t mb = (uint8_t)__builtin_ctz(lost);
+        s->stats.settled++;
+        CANSCHED_Done(s, mb, !(s->aborting & (1u << mb)), now);
+    }
+}
@@ -0,0 +1,74 @@
+#include "can_signal.h"
+
+#include <stddef.h>
+#include <string.h>
+
+CANSIG_Store cansig_store;
+
+const CANSIG_Message* CANSIG_Find(uint32_t id, uint8_t flags)
+{
+    const uint32_t key = id | ((flags & CANRX_EXT) ? CANSIG_KEY_EXT : 0u);
+
+    uint32_t lo = 0, hi = CANDB_MESSAGE_COUNT;
+    while (lo < hi)
+    {
+        const uint32_t mid = (lo + hi) / 2u;
+        if (cansig_messages[mid].key < key) lo = mid + 1u;
+        else hi = mid;
+    }
+    return (lo < CANDB_MESSAGE_COUNT && cansig_messages[lo].key == key) ? &cansig_messages[lo] : NULL;
+}
+
+// -----------------------------
+// Decode
+// -----------------------------
+static inline float cansig_value(const CANSIG_Def* d, uint64_t le, uint64_t be)
+{
+    uint32_t raw = (uint32_t)(((d->flags & CANSIG_MOTOROLA) ? be : le) >> d->shift);
+    if (d->len < 32u) raw &= (1u << d->len) - 1u;
+
+    float v;
+    if (d->flags & CANSIG_SIGNED)
+    {
+        const uint32_t pad = 32u - d->len;
+        v = (float)((int32_t)(raw << pad) >> pad);
+    }
+    else
+    {
+        v = (float)raw;
+    }
+    return v * d->scale + d->offset;
+}
+
+void CANSIG_Decode(const CANRX_Frame* frames, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const CANRX_Frame* f = &frames[i];
+        const CANSIG_Message* m = CANSIG_Find(f->id, f->flags);
+        if (m == NULL || (f->flags & CANRX_RTR))
+        {
+            cansig_store.unknown++;
+            continue;
+        }
+        if (f->dlc < m->dlc)
+        {
+            cansig_store.short_frames++;
+            continue;
+        }
+
+        // Both byte orders of the data once per frame; the swap only where a signal needs it
+        uint64_t le;
+        memcpy(&le, f->data, sizeof(le));
+        const uint64_t be = (m->flags & CANSIG_MOTOROLA) ? __builtin_bswap64(le) : 0u;
+
+        const CANSIG_Def* d = &cansig_defs[m->first];
+        float* out = &cansig_store.value[m->first];
+        for (uint32_t s = 0; s < m->count; s++) out[s] = cansig_value(&d[s], le, be);
+
+        const uint32_t msg = (uint32_t)(m - cansig_messages);
+        cansig_store.tick[msg] = f->tick;
+        cansig_store.updated[msg / 32u] |= 1u << (msg % 32u);
+        cansig_store.frames++;
+    }
+}
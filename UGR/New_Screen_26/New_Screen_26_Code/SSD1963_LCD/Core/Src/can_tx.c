@@ -0,0 +1,156 @@
+#include "can_tx.h"
+#include "main.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static CANSCHED_State cantx_sched;
+static CAN_HandleTypeDef* cantx_hcan;
+
+// The three mailboxes' bits in TSR repeat every 8 bits
+#define CANTX_TSR_STRIDE    8u
+
+static inline uint32_t cantx_lock(void)
+{
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void cantx_unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+// -----------------------------
+// Mailboxes
+// -----------------------------
+// Straight into the mailbox registers; the request bit goes in last, with the identifier
+static void cantx_load(CAN_TypeDef* can, uint8_t mb, const CANSCHED_Frame* f)
+{
+    CAN_TxMailBox_TypeDef* m = &can->sTxMailBox[mb];
+    uint32_t lo, hi;
+    memcpy(&lo, &f->data[0], 4);
+    memcpy(&hi, &f->data[4], 4);
+
+    m->TDTR = f->dlc;
+    m->TDLR = lo;
+    m->TDHR = hi;
+    m->TIR = ((f->flags & CANRX_EXT) ? ((f->id << CAN_TI0R_EXID_Pos) | CAN_TI0R_IDE) : (f->id << CAN_TI0R_STID_Pos)) |
+             CAN_TI0R_TXRQ;
+}
+
+// Completions first so their mailboxes count as free, then abort whatever holds back the
+// top of the queue, then refill. Runs with the TX interrupt held off.
+static void cantx_service(void)
+{
+    CAN_TypeDef* can = cantx_hcan->Instance;
+    const uint32_t now = HAL_GetTick();
+
+    const uint32_t tsr = can->TSR;
+    for (uint8_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+    {
+        const uint32_t rqcp = CAN_TSR_RQCP0 << (mb * CANTX_TSR_STRIDE);
+        if (!(tsr & rqcp)) continue;
+        // Clearing RQCP clears TXOK, ALST and TERR with it
+        can->TSR = rqcp;
+        CANSCHED_Done(&cantx_sched, mb, (tsr & (CAN_TSR_TXOK0 << (mb * CANTX_TSR_STRIDE))) != 0u, now);
+    }
+    // HAL_CAN_IRQHandler on a receive vector sees TMEIE too and may have taken RQCP
+    CANSCHED_Settle(&cantx_sched, (uint8_t)((tsr & CAN_TSR_TME) >> CAN_TSR_TME0_Pos), now);
+
+    uint8_t free = (uint8_t)((can->TSR & CAN_TSR_TME) >> CAN_TSR_TME0_Pos);
+    const uint8_t abort = CANSCHED_Preempt(&cantx_sched, free);
+    uint8_t mb;
+    for (mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+        if (abort & (1u << mb)) can->TSR = CAN_TSR_ABRQ0 << (mb * CANTX_TSR_STRIDE);
+
+    CANSCHED_Frame f;
+    while ((mb = CANSCHED_Next(&cantx_sched, free, &f)) != CANSCHED_NONE)
+    {
+        cantx_load(can, mb, &f);
+        free &= (uint8_t)~(1u << mb);
+    }
+}
+
+void CANTX_IRQHandler(void)
+{
+    // Same priority as the receive interrupts and above everything else that schedules
+    if (cantx_hcan) cantx_service();
+}
+
+void CANTX_Tick(void)
+{
+    if (!cantx_hcan) return;
+    const uint32_t primask = cantx_lock();
+    if (CANSCHED_Tick(&cantx_sched, HAL_GetTick())) cantx_service();
+    cantx_unlock(primask);
+}
+
+// -----------------------------
+// Application side
+// -----------------------------
+uint8_t CANTX_Send(uint32_t id, uint8_t flags, const uint8_t* data, uint8_t dlc)
+{
+    if (!cantx_hcan || dlc > 8u) return 0;
+
+    CANSCHED_Frame f = { .id = id, .dlc = dlc, .flags = flags };
+    memcpy(f.data, data, dlc);
+
+    const uint32_t primask = cantx_lock();
+    const uint8_t queued = CANSCHED_Queue(&cantx_sched, &f);
+    if (queued) cantx_service();
+    cantx_unlock(primask);
+    return queued;
+}
+
+uint8_t CANTX_AddPeriodic(uint32_t id, uint8_t flags, uint8_t dlc, uint16_t period_ms, uint16_t jitter_ms)
+{
+    const uint32_t primask = cantx_lock();
+    const uint8_t slot = CANSCHED_AddPeriodic(&cantx_sched, id, flags, dlc, period_ms, jitter_ms, HAL_GetTick());
+    cantx_unlock(primask);
+    return slot;
+}
+
+void CANTX_SetData(uint8_t slot, const uint8_t* data, uint8_t dlc)
+{
+    const uint32_t primask = cantx_lock();
+    CANSCHED_SetData(&cantx_sched, slot, data, dlc);
+    cantx_unlock(primask);
+}
+
+void CANTX_GetStats(CANTX_Stats* stats)
+{
+    const uint32_t primask = cantx_lock();
+    stats->sched = cantx_sched.stats;
+    stats->periodic_late = 0;
+    stats->periodic_skipped = 0;
+    for (uint32_t i = 0; i < cantx_sched.periodic_count; i++)
+    {
+        stats->periodic_late += cantx_sched.periodic[i].late;
+        stats->periodic_skipped += cantx_sched.periodic[i].skipped;
+    }
+    cantx_unlock(primask);
+}
+
+void CANTX_Print(void)
+{
+    CANTX_Stats s;
+    CANTX_GetStats(&s);
+    printf("can tx: %lu frames sent, %lu dropped (queue full), %lu preempted, peak %lu; periodic %lu late, %lu skipped\n",
+           (unsigned long)s.sched.sent, (unsigned long)s.sched.dropped, (unsigned long)s.sched.preempted,
+           (unsigned long)s.sched.peak, (unsigned long)s.periodic_late, (unsigned long)s.periodic_skipped);
+}
+
+// -----------------------------
+// Start
+// -----------------------------
+void CANTX_Start(CAN_HandleTypeDef* hcan)
+{
+    CANSCHED_Init(&cantx_sched, hcan->Init.TransmitFifoPriority == ENABLE);
+    cantx_hcan = hcan;
+
+    // RQCP of every mailbox: completion or abort. Enabled in IER directly, not through
+    // HAL_CAN_ActivateNotification: the transmit vector never reaches HAL_CAN_IRQHandler.
+    SET_BIT(hcan->Instance->IER, CAN_IER_TMEIE);
+}
@@ -0,0 +1,342 @@
+#include "clock_profile.h"
+
+// -----------------------------
+// Compile-time checks (RM0410 / DS11532 limits)
+// -----------------------------
+#if CLK_PROFILE != CLK_PROFILE_HSI16
+_Static_assert(CLK_HSE_HZ / CLK_PLLM >= 1000000UL && CLK_HSE_HZ / CLK_PLLM <= 2000000UL,
+               "PLL input must be 1-2 MHz");
+_Static_assert(CLK_HSE_HZ / CLK_PLLM * CLK_PLLN >= 100000000UL &&
+               CLK_HSE_HZ / CLK_PLLM * CLK_PLLN <= 432000000UL, "PLL VCO must be 100-432 MHz");
+_Static_assert(CLK_HSE_HZ / CLK_PLLM * CLK_PLLN / CLK_PLLQ == 48000000UL,
+               "PLLQ feeds the USB OTG FS 48 MHz clock");
+#endif
+
+_Static_assert(CLK_HCLK_HZ <= 216000000UL, "HCLK above 216 MHz");
+_Static_assert(CLK_HCLK_HZ <= 180000000UL || (CLK_VOS == 1 && CLK_OVERDRIVE),
+               "HCLK above 180 MHz needs VOS1 and overdrive");
+_Static_assert(CLK_HCLK_HZ <= 168000000UL || CLK_VOS == 1, "HCLK above 168 MHz needs VOS1");
+_Static_assert(CLK_HCLK_HZ <= 144000000UL || CLK_VOS <= 2, "HCLK above 144 MHz needs VOS1 or VOS2");
+_Static_assert(CLK_FLASH_WS >= CLK_FLASH_WS_MIN(CLK_HCLK_HZ), "Too few flash wait states for HCLK");
+_Static_assert(CLK_PCLK1_HZ <= 54000000UL, "APB1 above 54 MHz");
+_Static_assert(CLK_PCLK2_HZ <= 108000000UL, "APB2 above 108 MHz");
+
+// The SSD1963 bus has to fit the BTR1 (read) and BWTR1 (write) fields at the selected HCLK
+_Static_assert(CLK_FMC_ADDSET(CLK_HCLK_HZ) <= 15u, "LCD_T_AS_NS does not fit ADDSET");
+_Static_assert(CLK_FMC_DATAST(CLK_HCLK_HZ) <= 255u, "LCD_T_WRL_NS does not fit DATAST");
+_Static_assert(CLK_FMC_BUSTURN(CLK_HCLK_HZ) <= 15u, "LCD_T_WRH_NS does not fit BUSTURN");
+_Static_assert(CLK_FMC_RD_DATAST(CLK_HCLK_HZ) <= 255u, "LCD_T_RDL_NS does not fit DATAST");
+_Static_assert(CLK_FMC_RD_BUSTURN(CLK_HCLK_HZ) <= 15u, "LCD_T_RDH_NS does not fit BUSTURN");
+
+// I2C modes: the spec figures must add up to the bus period, and the slowest phase must
+// still be reachable with PRESC = 15 and an 8-bit SCLL at the profile's PCLK1
+#define CLK_I2C_CHECK(name, hz, low, high, tr, tf, su, hd, vd) \
+    _Static_assert((uint64_t)(low) + (high) + (tr) + (tf) <= 1000000000ULL / (hz), \
+                   "I2C " #name ": tLOW + tHIGH + tr + tf exceed the period"); \
+    _Static_assert((su) + (tr) <= (low), "I2C " #name ": data setup does not fit in tLOW"); \
+    _Static_assert((hd) < (vd), "I2C " #name ": tHD;DAT above tVD;DAT"); \
+    _Static_assert(CLK_NS_TO_CYCLES(1000000000ULL / (hz), CLK_PCLK1_HZ) / 16u <= 512u, \
+                   "I2C " #name ": period too long for TIMINGR at PCLK1");
+CLK_I2C_MODES(CLK_I2C_CHECK)
+#undef CLK_I2C_CHECK
+
+// CAN2 runs at CLK_CAN2_BITRATE exactly at the profile's PCLK1, near an 87.5% sample point
+_Static_assert(CLK_CAN_TQ(CLK_PCLK1_HZ, CLK_CAN2_BITRATE) != 0u, "CLK_CAN2_BITRATE not exact at PCLK1");
+_Static_assert(CLK_CAN_BS1(CLK_CAN_TQ(CLK_PCLK1_HZ, CLK_CAN2_BITRATE)) <= 16u &&
+               CLK_CAN_BS2(CLK_CAN_TQ(CLK_PCLK1_HZ, CLK_CAN2_BITRATE)) <= 8u, "CAN segments out of range");
+_Static_assert((1u + CLK_CAN_BS1(CLK_CAN_TQ(CLK_PCLK1_HZ, CLK_CAN2_BITRATE))) * 1000u >=
+               800u * CLK_CAN_TQ(CLK_PCLK1_HZ, CLK_CAN2_BITRATE), "CAN2 sample point below 80%");
+
+// -----------------------------
+// Runtime conversions
+// -----------------------------
+typedef struct
+{
+    uint32_t hz;
+    uint16_t low, high, tr, tf, su, hd, vd;
+} CLK_I2cSpec;
+
+static const CLK_I2cSpec clk_i2c_spec[CLK_I2C_MODE_COUNT] = {
+#define CLK_I2C_ROW(name, hz, low, high, tr, tf, su, hd, vd) { hz, low, high, tr, tf, su, hd, vd },
+    CLK_I2C_MODES(CLK_I2C_ROW)
+#undef CLK_I2C_ROW
+};
+
+static uint32_t clk_cycles(uint32_t ns, uint32_t hz)
+{
+    return CLK_NS_TO_CYCLES(ns, hz);
+}
+
+static uint8_t clk_fmc_strobe(uint32_t ns, uint32_t hz)
+{
+    const uint32_t c = clk_cycles(ns, hz);
+    return (uint8_t)((c == 0u) ? 1u : (c > 255u) ? 255u : c);
+}
+
+static uint8_t clk_fmc_recovery(uint32_t ns, uint32_t addset, uint32_t hz)
+{
+    const uint32_t high = clk_cycles(ns, hz);
+    return (uint8_t)((high > addset + 1u) ? ((high - addset - 1u > 15u) ? 15u : high - addset - 1u) : 0u);
+}
+
+void CLK_LcdBusTiming(uint32_t hclk_hz, CLK_FmcTiming* out)
+{
+    const uint32_t addset = clk_cycles(LCD_T_AS_NS, hclk_hz);
+
+    out->addset = (uint8_t)((addset > 15u) ? 15u : addset);
+    out->datast = clk_fmc_strobe(LCD_T_WRL_NS, hclk_hz);
+    out->busturn = clk_fmc_recovery(LCD_T_WRH_NS, addset, hclk_hz);
+    out->rd_datast = clk_fmc_strobe(LCD_T_RDL_NS, hclk_hz);
+    out->rd_busturn = clk_fmc_recovery(LCD_T_RDH_NS, addset, hclk_hz);
+}
+
+// RM0410 32.4.9: SCLDEL covers tr + tSU;DAT, SDADEL covers tf + tHD;DAT less the analog
+// filter delay (50 ns min, 260 ns max) and the 3-cycle input sync. SCLL/SCLH cover tLOW
+// and tHIGH; whatever the period still lacks after the sync delays is split between them.
+uint32_t CLK_I2cTiming(uint32_t i2cclk_hz, CLK_I2cMode mode)
+{
+    if (mode >= CLK_I2C_MODE_COUNT || i2cclk_hz == 0u) return 0;
+
+    const CLK_I2cSpec* s = &clk_i2c_spec[mode];
+    const uint64_t tclk = 1000000000000ULL / i2cclk_hz;     // ps
+    const uint64_t period = 1000000000000ULL / s->hz;
+    const uint64_t af_min = 50000u, af_max = 260000u;
+
+    for (uint32_t presc = 0; presc < 16u; presc++)
+    {
+        const uint64_t tpresc = (presc + 1u) * tclk;
+
+        const uint64_t scl_need = ((uint64_t)s->tr + s->su) * 1000u;
+        uint64_t scldel = (scl_need + tpresc - 1u) / tpresc;
+        scldel = scldel ? scldel - 1u : 0u;
+        if (scldel > 15u) continue;
+
+        const int64_t sda_need = (int64_t)((uint64_t)s->tf + s->hd) * 1000 - (int64_t)af_min - 3 * (int64_t)tclk;
+        const uint64_t sdadel = (sda_need > 0) ? ((uint64_t)sda_need + tpresc - 1u) / tpresc : 0u;
+        if (sdadel > 15u) continue;
+        if (sdadel * tpresc + (uint64_t)s->tr * 1000u + af_max + 4u * tclk > (uint64_t)s->vd * 1000u) continue;
+
+        uint64_t scll = ((uint64_t)s->low * 1000u + tpresc - 1u) / tpresc;
+        uint64_t sclh = ((uint64_t)s->high * 1000u + tpresc - 1u) / tpresc;
+        const uint64_t sync = (uint64_t)s->tr * 1000u + (uint64_t)s->tf * 1000u + 2u * (af_min + 2u * tclk);
+        const uint64_t total = (scll + sclh) * tpresc + sync;
+        if (total < period)
+        {
+            const uint64_t extra = (period - total + tpresc - 1u) / tpresc;
+            scll += extra - extra / 2u;
+            sclh += extra / 2u;
+        }
+        if (scll == 0u || sclh == 0u || scll > 256u || sclh > 256u) continue;
+
+        return (presc << 28) | ((uint32_t)scldel << 20) | ((uint32_t)sdadel << 16) |
+               ((uint32_t)(sclh - 1u) << 8) | (uint32_t)(scll - 1u);
+    }
+
+    return 0;
+}
+
+uint8_t CLK_CanTiming(uint32_t pclk_hz, uint32_t bitrate, uint16_t sample_permille, CLK_CanBitTiming* out)
+{
+    if (pclk_hz == 0u || bitrate == 0u) return 0;
+
+    uint8_t found = 0;
+    uint64_t best_err = 0;
+    uint64_t best_dist = 0;     // |sample - target| in permille, times N
+    uint32_t best_n = 0;
+
+    // Most quanta first, and within a count the longer BS2 first, so ties keep the
+    // earlier (finer) choice
+    for (uint32_t n = 25u; n >= 8u; n--)
+    {
+        const uint64_t div = (uint64_t)bitrate * n;
+        uint64_t presc = (pclk_hz + div / 2u) / div;
+        if (presc == 0u) presc = 1u;
+        if (presc > 1024u) continue;
+
+        // |pclk / (presc * n) - bitrate| / bitrate, rounded up so only an exact rate is 0
+        const uint64_t den = div * presc;
+        const uint64_t off = (pclk_hz > den) ? pclk_hz - den : den - pclk_hz;
+        const uint64_t err = (off * 1000000ULL + den - 1u) / den;
+        if (err > CLK_CAN_MAX_ERROR_PPM) continue;
+
+        for (uint32_t bs2 = 8u; bs2 >= 1u; bs2--)
+        {
+            if (n < bs2 + 2u) continue;
+            const uint32_t bs1 = n - 1u - bs2;
+            if (bs1 < 1u || bs1 > 16u) continue;
+
+            const int64_t d = (int64_t)(1u + bs1) * 1000 - (int64_t)sample_permille * n;
+            const uint64_t dist = (uint64_t)(d < 0 ? -d : d);
+
+            // dist / n against best_dist / best_n
+            const uint8_t better = !found || err < best_err ||
+                                   (err == best_err && dist * best_n < best_dist * n);
+            if (!better) continue;
+
+            found = 1;
+            best_err = err;
+            best_dist = dist;
+            best_n = n;
+            out->prescaler = (uint16_t)presc;
+            out->bs1 = (uint8_t)bs1;
+            out->bs2 = (uint8_t)bs2;
+            out->sjw = (uint8_t)((bs2 < 4u) ? bs2 : 4u);
+            out->sample_permille = (uint16_t)(((1u + bs1) * 1000u + n / 2u) / n);
+            out->error_ppm = (uint32_t)err;
+        }
+    }
+    return found;
+}
+
+// -----------------------------
+// Hardware
+// -----------------------------
+#ifndef SSD1963_HOST_SIM
+void CLK_ApplyProfile(void)
+{
+#if CLK_PROFILE == CLK_PROFILE_PLL216
+    RCC_OscInitTypeDef osc = {0};
+    RCC_ClkInitTypeDef clk = {0};
+
+    // VOS only takes a new scale while the PLL is off, and SystemClock_Config leaves it
+    // running from HSE: make sure SYSCLK is on HSI, then stop the PLL
+    if (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_HSI)
+    {
+        clk.ClockType = RCC_CLOCKTYPE_SYSCLK;
+        clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+        if (HAL_RCC_ClockConfig(&clk, __HAL_FLASH_GET_LATENCY()) != HAL_OK)
+        {
+            Error_Handler();
+        }
+    }
+
+    osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+    osc.PLL.PLLState = RCC_PLL_OFF;
+    if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // Raise the core voltage before the frequency, never after
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
+
+    // The PLL re-locks with the new factors; the scale takes effect once it is ready
+    osc.OscillatorType = RCC_OSCILLATORTYPE_HSE;
+    osc.HSEState = RCC_HSE_ON;
+    osc.PLL.PLLState = RCC_PLL_ON;
+    osc.PLL.PLLSource = RCC_PLLSOURCE_HSE;
+    osc.PLL.PLLM = CLK_PLLM;
+    osc.PLL.PLLN = CLK_PLLN;
+    osc.PLL.PLLP = RCC_PLLP_DIV2;
+    osc.PLL.PLLQ = CLK_PLLQ;
+    osc.PLL.PLLR = 2;
+    if (HAL_RCC_OscConfig(&osc) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    if (HAL_PWREx_EnableOverDrive() != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clk.SYSCLKSource = RCC_SYSCLKSOURCE_PLLCLK;
+    clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    clk.APB1CLKDivider = RCC_HCLK_DIV4;
+    clk.APB2CLKDivider = RCC_HCLK_DIV2;
+    // HAL_RCC_ClockConfig raises the wait states before switching up
+    if (HAL_RCC_ClockConfig(&clk, FLASH_LATENCY_7) != HAL_OK)
+    {
+        Error_Handler();
+    }
+
+    // ART and prefetch serve code fetched over the ITCM flash interface
+    __HAL_FLASH_ART_RESET();
+    __HAL_FLASH_ART_ENABLE();
+    __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+#endif
+}
+
+void CLK_ApplyFmcTiming(SRAM_HandleTypeDef* hsram)
+{
+    CLK_FmcTiming t;
+    FMC_NORSRAM_TimingTypeDef rd = {0};
+    FMC_NORSRAM_TimingTypeDef wr = {0};
+
+    CLK_LcdBusTiming(HAL_RCC_GetHCLKFreq(), &t);
+    rd.AddressSetupTime = t.addset;
+    rd.AddressHoldTime = 15;            // unused in mode A, kept in range
+    rd.DataSetupTime = t.rd_datast;
+    rd.BusTurnAroundDuration = t.rd_busturn;
+    rd.CLKDivision = 16;
+    rd.DataLatency = 17;
+    rd.AccessMode = FMC_ACCESS_MODE_A;
+
+    wr = rd;
+    wr.DataSetupTime = t.datast;
+    wr.BusTurnAroundDuration = t.busturn;
+
+    // CubeMX initialises the bank without extended mode. BWTR1 is written before EXTMOD
+    // is set, so no access ever runs with a half-programmed write timing.
+    if (FMC_NORSRAM_Extended_Timing_Init(hsram->Extended, &wr, hsram->Init.NSBank, FMC_EXTENDED_MODE_ENABLE) != HAL_OK ||
+        FMC_NORSRAM_Timing_Init(hsram->Instance, &rd, hsram->Init.NSBank) != HAL_OK)
+    {
+        Error_Handler();
+    }
+    hsram->Init.ExtendedMode = FMC_EXTENDED_MODE_ENABLE;
+    SET_BIT(hsram->Instance->BTCR[hsram->Init.NSBank], FMC_BCR1_EXTMOD);
+}
+
+void CLK_ApplyI2cTiming(I2C_HandleTypeDef* hi2c, CLK_I2cMode mode)
+{
+    // I2C1 kernel clock is PCLK1 (HAL_I2C_MspInit)
+    const uint32_t timing = CLK_I2cTiming(HAL_RCC_GetPCLK1Freq(), mode);
+    if (timing == 0u) return;
+
+    // TIMINGR is only writable with the peripheral disabled
+    __HAL_I2C_DISABLE(hi2c);
+    hi2c->Init.Timing = timing;
+    hi2c->Instance->TIMINGR = timing & 0xF0FFFFFFu;
+    __HAL_I2C_ENABLE(hi2c);
+}
+
+void CLK_ApplyCanTiming(CAN_HandleTypeDef* hcan, uint32_t bitrate)
+{
+    CLK_CanBitTiming t;
+    if (!CLK_CanTiming(HAL_RCC_GetPCLK1Freq(), bitrate, CLK_CAN_SAMPLE_PERMILLE, &t))
+    {
+        Error_Handler();
+    }
+
+    // HAL_CAN_Init leaves initialisation mode again, so the controller is stopped here
+    hcan->Init.Prescaler = t.prescaler;
+    hcan->Init.TimeSeg1 = (uint32_t)(t.bs1 - 1u) << CAN_BTR_TS1_Pos;
+    hcan->Init.TimeSeg2 = (uint32_t)(t.bs2 - 1u) << CAN_BTR_TS2_Pos;
+    hcan->Init.SyncJumpWidth = (uint32_t)(t.sjw - 1u) << CAN_BTR_SJW_Pos;
+    if (HAL_CAN_Init(hcan) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
+
+uint32_t CLK_SpiPrescaler(uint32_t pclk_hz, uint32_t max_hz)
+{
+    static const uint32_t prescalers[] = {
+        SPI_BAUDRATEPRESCALER_2, SPI_BAUDRATEPRESCALER_4, SPI_BAUDRATEPRESCALER_8,
+        SPI_BAUDRATEPRESCALER_16, SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_64,
+        SPI_BAUDRATEPRESCALER_128, SPI_BAUDRATEPRESCALER_256
+    };
+
+    for (uint32_t i = 0; i < sizeof(prescalers) / sizeof(prescalers[0]); i++)
+    {
+        if ((pclk_hz >> (i + 1u)) <= max_hz) return prescalers[i];
+    }
+    return SPI_BAUDRATEPRESCALER_256;
+}
+#else
+void CLK_ApplyProfile(void)
+{
+}
+#endif
@@ -22,6 +22,8 @@
 #include "fmc.h"
 
 /* USER CODE BEGIN 0 */
+#include "clock_profile.h"
+#include "boot.h"
 
 /* USER CODE END 0 */
 
@@ -76,6 +78,12 @@ void MX_FMC_Init(void)
   }
 
   /* USER CODE BEGIN FMC_Init 2 */
+  // Timing above is sized for the 16 MHz boot clock: replace it with the SSD1963
+  // nanosecond requirements converted for the running HCLK
+  CLK_ApplyFmcTiming(&hsram1);
+
+  // The bus is usable from here: start the panel reset sequence, SysTick carries it on
+  BOOT_PanelStart();
 
   /* USER CODE END FMC_Init 2 */
 }
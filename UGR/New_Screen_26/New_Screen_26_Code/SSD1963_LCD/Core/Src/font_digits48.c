@@ -0,0 +1,328 @@
+// Generated by Host/Tools/fontgen.py from SourceCodePro-Bold.ttf, do not edit.
+//   fontgen.py SourceCodePro-Bold.ttf 48 --bpp 4 --name digits48 --chars ' +-.0123456789:'
+// 15 glyphs, 4499 bitmap bytes, line height 62 px
+#include "ssd1963_font.h"
+
+static const uint8_t digits48_bitmap[] = {
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x55, 0x55, 0x57, 0xFF, 0xFF, 0xF5, 0x55,
+    0x55, 0x55, 0x52, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x69, 0x99, 0x99, 0x99, 0xAF, 0xFF, 0xFF, 0x99, 0x99, 0x99, 0x99, 0x40, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x2A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x76, 0x99, 0x99,
+    0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x94, 0x00, 0x01, 0x6A, 0xA9, 0x50, 0x00, 0x00,
+    0x4E, 0xFF, 0xFF, 0xFC, 0x20, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xD1, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFE, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x02,
+    0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2C, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x48, 0x87, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0xBE, 0xFF, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x90, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x2F, 0xFF, 0xFF,
+    0xFF, 0xC8, 0x78, 0xDF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xF6, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x6F, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x30, 0x0A, 0xFF,
+    0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF7, 0x00, 0xDF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xA0, 0x1F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x10, 0x00, 0x07,
+    0xFF, 0xFF, 0xFC, 0x02, 0xFF, 0xFF, 0xFF, 0x20, 0x19, 0xFF, 0xE7, 0x00, 0x5F, 0xFF, 0xFF, 0xE0,
+    0x4F, 0xFF, 0xFF, 0xF1, 0x0A, 0xFF, 0xFF, 0xF7, 0x04, 0xFF, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xFF,
+    0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF, 0xFF, 0xF1, 0x5F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x24, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xD0, 0x3F, 0xFF,
+    0xFF, 0xF1, 0x4F, 0xFF, 0xFF, 0xF0, 0x0B, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0x13, 0xFF,
+    0xFF, 0xFF, 0x10, 0x1A, 0xFF, 0xF8, 0x00, 0x4F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF3, 0x00,
+    0x01, 0x31, 0x00, 0x06, 0xFF, 0xFF, 0xFD, 0x00, 0xEF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x9F, 0xFF, 0xFF, 0xB0, 0x0B, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF8,
+    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0x40, 0x02, 0xFF, 0xFF,
+    0xFF, 0x60, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xE0, 0x00, 0x0C, 0xFF, 0xFF, 0xFE, 0x20, 0x00,
+    0x00, 0x4F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFD, 0x50, 0x01, 0x6E, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x68, 0x88, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0x88, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDF, 0xFF,
+    0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xAE, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00,
+    0x00, 0x05, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0,
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x05,
+    0xAA, 0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
+    0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
+    0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xD0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x01, 0xAA, 0xAA,
+    0xAA, 0xAB, 0xFF, 0xFF, 0xFF, 0xEA, 0xAA, 0xAA, 0xA8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0xCE, 0xFF, 0xFD, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC2, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x4E,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xB8,
+    0x78, 0xCF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x01, 0xCF, 0xFF, 0xB2, 0x00, 0x00, 0x03, 0xEF, 0xFF,
+    0xFF, 0xF9, 0x00, 0x00, 0x1C, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+    0x01, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFD,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF,
+    0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFB, 0xBC, 0xDE, 0xEE, 0xEE, 0xEE, 0xEA, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x59, 0xCE, 0xFF, 0xFE, 0xC9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFB, 0x10, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x09,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xC9,
+    0x77, 0x9E, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x1D, 0xFF, 0xB3, 0x00, 0x00, 0x01, 0x9F, 0xFF,
+    0xFF, 0xFF, 0x40, 0x00, 0x02, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF,
+    0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x23, 0x47, 0xBF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEE,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x6A, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F,
+    0xFF, 0xFF, 0xF7, 0x00, 0x4D, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF7, 0x01,
+    0xDF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xF4, 0x0A, 0xFF, 0xFF, 0xFA, 0x63,
+    0x22, 0x48, 0xDF, 0xFF, 0xFF, 0xFF, 0xE1, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x70, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x09,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x67, 0x88, 0x87, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x88, 0x88, 0x88, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
+    0xFF, 0xC7, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x38, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xF8, 0x08, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xD0, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xFF, 0xFF, 0xFF, 0x40, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFF,
+    0xF8, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xC0, 0x00, 0x09,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x09, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+    0xAF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFE,
+    0x20, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFD, 0xAA, 0xAA, 0xAA,
+    0xAD, 0xFF, 0xFF, 0xFF, 0xAA, 0xA8, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+    0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x5F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x3A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xAD, 0xFF, 0xFF, 0xFF, 0xAA, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFE,
+    0x00, 0x00, 0x00, 0x04, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x10, 0x00, 0x09,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x0C,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x0D, 0xFF, 0xFF, 0xFC, 0x88,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x10, 0x00, 0x0D, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+    0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF2, 0x47, 0x88, 0x75, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE4, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x10, 0x00, 0x07, 0xFF, 0xFF, 0xB7, 0x77, 0x8D, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+    0x2B, 0x82, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF,
+    0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xF6, 0x00, 0x2D, 0x50, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF,
+    0xFF, 0xF4, 0x00, 0xCF, 0xFA, 0x20, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xE0, 0x08, 0xFF,
+    0xFF, 0xFA, 0x63, 0x23, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE3, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x2A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x57, 0x88, 0x87, 0x41, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0xCE, 0xFF, 0xFD, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE6, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x04, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xEB, 0xAB, 0xEF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFE, 0x60,
+    0x00, 0x00, 0x4B, 0xFE, 0x30, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x06,
+    0x50, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF3,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xA0, 0x01, 0x6B, 0xEF, 0xFE, 0xB7, 0x10, 0x00,
+    0x00, 0x0F, 0xFF, 0xFF, 0xF8, 0x06, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0x7A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x20, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0x00, 0x16, 0xDF, 0xFF, 0xFF, 0xF8, 0x01,
+    0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xFF, 0xD0, 0x0E, 0xFF, 0xFF, 0xFD,
+    0x20, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x10, 0xCF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+    0x00, 0x5F, 0xFF, 0xFF, 0xF2, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF,
+    0xFF, 0x20, 0x5F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xF1, 0x01, 0xEF,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFE, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x50,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x05, 0xEF,
+    0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xEB, 0xBD, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x01, 0xBF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0x88, 0x86, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x08, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xEF,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xDF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xF4,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFD, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF,
+    0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x8B, 0xEF, 0xFF, 0xEC, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFE, 0x40, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
+    0x0C, 0xFF, 0xFF, 0xFF, 0xFE, 0xDE, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFC,
+    0x30, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x9F, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x01, 0xDF,
+    0xFF, 0xFF, 0x60, 0x00, 0xBF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x80, 0x00,
+    0xCF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x80, 0x00, 0xAF, 0xFF, 0xFF, 0x90,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x70, 0x00, 0x7F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x8F,
+    0xFF, 0xFF, 0x30, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x71, 0x00, 0x02, 0xEF, 0xFF, 0xFB, 0x00, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x82, 0x1C, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xDF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x00, 0x00,
+    0x00, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFD,
+    0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xC1, 0x02, 0x8D, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x01, 0xEF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xF2, 0x08,
+    0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xF8, 0x0D, 0xFF, 0xFF, 0xF2, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x0A,
+    0xFF, 0xFF, 0xFD, 0x1F, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x0E,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFC, 0x0B, 0xFF, 0xFF, 0xFF, 0x81,
+    0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xF8, 0x05, 0xFF, 0xFF, 0xFF, 0xFE, 0x96, 0x56, 0x8E, 0xFF,
+    0xFF, 0xFF, 0xF2, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+    0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x78, 0x88, 0x75, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBD,
+    0xFF, 0xFD, 0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00,
+    0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFA, 0x54, 0x59, 0xFF, 0xFF,
+    0xFF, 0xF8, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0x20, 0x2F,
+    0xFF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x80, 0x5F, 0xFF, 0xFF, 0xF3, 0x00,
+    0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xD0, 0x6F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x5F,
+    0xFF, 0xFF, 0xF3, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF6, 0x6F,
+    0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xF9, 0x4F, 0xFF, 0xFF, 0xF7, 0x00,
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFB, 0x1F, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x3C, 0xFF,
+    0xFF, 0xFF, 0xFC, 0x0A, 0xFF, 0xFF, 0xFF, 0xFB, 0x77, 0x8B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x1B,
+    0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x0D, 0xFF, 0xFF, 0xF9, 0x00,
+    0x00, 0x00, 0x15, 0x78, 0x86, 0x20, 0x00, 0x1F, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF,
+    0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x02, 0xDA, 0x20, 0x00,
+    0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x1C, 0xFF, 0xF9, 0x52, 0x24, 0x8E, 0xFF, 0xFF,
+    0xFF, 0xF5, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x0A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x06, 0xEF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x68, 0x88, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x32, 0x00,
+    0x00, 0x00, 0x07, 0xEF, 0xFF, 0xD5, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0x70, 0x06, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF3, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF9, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x05, 0xCF,
+    0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xA9, 0x50,
+    0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFC, 0x20, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xD1, 0x0A, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xF7, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x09, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF6, 0x02, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x2C, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x48,
+    0x87, 0x30, 0x00,
+};
+
+static const SSD1963_Glyph digits48_glyphs[] = {
+    // offset, w, h, x_off, y_off, advance
+    {      0,   0,   0,    0,    0,  29 },  // ' '
+    {      0,   0,   0,    0,    0,   0 },  // '!' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '"' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '#' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '$' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '%' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '&' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // ''' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '(' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // ')' (absent)
+    {      0,   0,   0,    0,    0,   0 },  // '*' (absent)
+    {      0,  23,  24,    3,  -28,  29 },  // '+'
+    {      0,   0,   0,    0,    0,   0 },  // ',' (absent)
+    {    276,  23,   6,    3,  -19,  29 },  // '-'
+    {    345,  12,  12,    8,  -11,  29 },  // '.'
+    {      0,   0,   0,    0,    0,   0 },  // '/' (absent)
+    {    417,  25,  33,    2,  -32,  29 },  // '0'
+    {    830,  23,  31,    3,  -31,  29 },  // '1'
+    {   1187,  24,  32,    2,  -32,  29 },  // '2'
+    {   1571,  24,  33,    2,  -32,  29 },  // '3'
+    {   1967,  26,  31,    1,  -31,  29 },  // '4'
+    {   2370,  24,  32,    2,  -31,  29 },  // '5'
+    {   2754,  25,  33,    2,  -32,  29 },  // '6'
+    {   3167,  24,  31,    2,  -31,  29 },  // '7'
+    {   3539,  24,  33,    2,  -32,  29 },  // '8'
+    {   3935,  24,  33,    2,  -32,  29 },  // '9'
+    {   4331,  12,  28,    8,  -27,  29 },  // ':'
+};
+
+const SSD1963_Font font_digits48 = {
+    digits48_bitmap,
+    digits48_glyphs,
+    32, 58,  // first, last
+    4,  // bpp
+    62, 48  // line height, ascent
+};
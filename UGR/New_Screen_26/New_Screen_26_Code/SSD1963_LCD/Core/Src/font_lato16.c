@@ -0,0 +1,380 @@
+// Generated by Host/Tools/fontgen.py from Lato-Regular.ttf, do not edit.
+//   fontgen.py Lato-Regular.ttf 16 --bpp 4 --name lato16
+// 95 glyphs, 4245 bitmap bytes, line height 20 px
+#include "ssd1963_font.h"
+
+static const uint8_t lato16_bitmap[] = {
+    0x06, 0x30, 0xE7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE7, 0x0D, 0x60, 0xC5, 0x00, 0x00, 0x00, 0x1C,
+    0x72, 0xF9, 0x01, 0x00, 0x53, 0x17, 0x1C, 0x72, 0xF2, 0xC7, 0x2F, 0x2B, 0x61, 0xF1, 0x52, 0x08,
+    0x00, 0x00, 0x03, 0x40, 0x34, 0x00, 0x00, 0xA7, 0x08, 0xA0, 0x00, 0x0E, 0x40, 0xB7, 0x00, 0x12,
+    0xF2, 0x1E, 0x41, 0x1E, 0xEF, 0xEE, 0xFE, 0xA0, 0x07, 0xB0, 0x4D, 0x00, 0x00, 0xA8, 0x07, 0xA0,
+    0x03, 0x7D, 0xA7, 0xCB, 0x72, 0x5A, 0xFA, 0x9E, 0xB9, 0x20, 0x3F, 0x01, 0xF2, 0x00, 0x06, 0xC0,
+    0x4E, 0x00, 0x00, 0x98, 0x06, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xB0, 0x00,
+    0x00, 0x05, 0x9D, 0x50, 0x00, 0x0B, 0xEC, 0xDE, 0xD1, 0x07, 0xE2, 0x58, 0x15, 0x00, 0xAB, 0x06,
+    0x70, 0x00, 0x08, 0xE3, 0x76, 0x00, 0x00, 0x1C, 0xFE, 0x91, 0x00, 0x00, 0x05, 0xDF, 0xF7, 0x00,
+    0x00, 0x0A, 0x48, 0xF4, 0x00, 0x00, 0xC2, 0x0E, 0x70, 0x20, 0x0D, 0x11, 0xE5, 0x0E, 0xB3, 0xE3,
+    0xBD, 0x10, 0x3B, 0xFF, 0xFB, 0x20, 0x00, 0x01, 0xD1, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x00, 0x01,
+    0x78, 0x30, 0x00, 0x02, 0x60, 0x1D, 0x87, 0xE3, 0x00, 0x0C, 0x70, 0x5C, 0x00, 0x88, 0x00, 0x9B,
+    0x00, 0x6B, 0x00, 0x7A, 0x05, 0xE1, 0x00, 0x3E, 0x10, 0xB6, 0x2E, 0x40, 0x00, 0x08, 0xED, 0xB1,
+    0xC8, 0x00, 0x00, 0x00, 0x11, 0x09, 0xB0, 0x68, 0x50, 0x00, 0x00, 0x5E, 0x29, 0xB6, 0xC7, 0x00,
+    0x02, 0xE4, 0x0F, 0x20, 0x3E, 0x00, 0x0C, 0x80, 0x1F, 0x10, 0x2F, 0x00, 0x8C, 0x00, 0x0D, 0x50,
+    0x6B, 0x05, 0xE2, 0x00, 0x04, 0xDC, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x88,
+    0x50, 0x00, 0x00, 0x00, 0x3E, 0xB8, 0xE9, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x3F, 0x10, 0x00, 0x00,
+    0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x10, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xB1, 0x00, 0x00,
+    0x00, 0x04, 0xE9, 0xDB, 0x10, 0x4B, 0x00, 0x1E, 0x80, 0x2E, 0xB1, 0x8B, 0x00, 0x4F, 0x20, 0x02,
+    0xEB, 0xD6, 0x00, 0x4F, 0x30, 0x00, 0x2E, 0xE1, 0x00, 0x0D, 0xC3, 0x13, 0xAD, 0xEA, 0x00, 0x02,
+    0xBF, 0xFE, 0x91, 0x3E, 0xA0, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x53, 0xC7, 0xC7, 0xB6, 0x52,
+    0x00, 0x30, 0x04, 0xE1, 0x0C, 0x80, 0x3F, 0x20, 0x7C, 0x00, 0xB8, 0x00, 0xD6, 0x00, 0xE5, 0x00,
+    0xE5, 0x00, 0xD6, 0x00, 0xB9, 0x00, 0x7C, 0x00, 0x2F, 0x20, 0x0B, 0x90, 0x04, 0xE1, 0x00, 0x20,
+    0x03, 0x00, 0x4E, 0x10, 0x0D, 0x70, 0x06, 0xD0, 0x01, 0xF3, 0x00, 0xD6, 0x00, 0xB8, 0x00, 0x99,
+    0x00, 0x99, 0x00, 0xB8, 0x00, 0xD6, 0x02, 0xF3, 0x07, 0xD0, 0x0D, 0x70, 0x5D, 0x10, 0x02, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x38, 0x00, 0x1B, 0x69, 0x95, 0x01, 0xDF, 0x50, 0x1B, 0x7A, 0xA5, 0x00,
+    0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00,
+    0xE3, 0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x3E, 0xEE, 0xFE, 0xEE, 0x71, 0x33, 0x3F, 0x53, 0x31,
+    0x00, 0x00, 0xE3, 0x00, 0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x2C, 0x62,
+    0xEA, 0x06, 0x61, 0xB0, 0x00, 0x00, 0x16, 0x66, 0x42, 0xCC, 0xC9, 0x2C, 0x63, 0xF9, 0x01, 0x00,
+    0x00, 0x00, 0x02, 0xB0, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x6B, 0x00,
+    0x00, 0x00, 0xC5, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x1E, 0x20, 0x00,
+    0x00, 0x6B, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00,
+    0x0A, 0x20, 0x00, 0x00, 0x00, 0x16, 0x87, 0x20, 0x00, 0x2D, 0xDA, 0xCF, 0x50, 0x0B, 0xC1, 0x00,
+    0x9E, 0x12, 0xF5, 0x00, 0x01, 0xF6, 0x6F, 0x10, 0x00, 0x0C, 0xA7, 0xF0, 0x00, 0x00, 0xBC, 0x8E,
+    0x00, 0x00, 0x0A, 0xC7, 0xF0, 0x00, 0x00, 0xBB, 0x4F, 0x30, 0x00, 0x0E, 0x91, 0xE8, 0x00, 0x04,
+    0xF4, 0x07, 0xF6, 0x14, 0xDB, 0x00, 0x07, 0xEF, 0xF9, 0x10, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x02, 0x71, 0x00, 0x00, 0x3E, 0xF3, 0x00, 0x05, 0xEC, 0xF3, 0x00, 0x2F, 0x74, 0xF3, 0x00, 0x02,
+    0x04, 0xF3, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x00,
+    0x04, 0xF3, 0x00, 0x00, 0x04, 0xF3, 0x00, 0x01, 0x14, 0xF4, 0x10, 0x0B, 0xFF, 0xFF, 0xF7, 0x00,
+    0x16, 0x88, 0x30, 0x00, 0x1D, 0xEA, 0xCF, 0x70, 0x09, 0xD1, 0x00, 0x8F, 0x10, 0xA6, 0x00, 0x03,
+    0xF4, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x09, 0xE2, 0x00, 0x00,
+    0x08, 0xE3, 0x00, 0x00, 0x08, 0xE3, 0x00, 0x00, 0x08, 0xE3, 0x00, 0x00, 0x08, 0xF8, 0x66, 0x66,
+    0x22, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x05, 0x88, 0x40, 0x00, 0x0B, 0xEA, 0xBF, 0x90, 0x07, 0xE2,
+    0x00, 0x6F, 0x30, 0x87, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0x10, 0x00, 0x05, 0x9D, 0x50,
+    0x00, 0x00, 0x8C, 0xE7, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x02, 0x00, 0x00, 0x0D, 0x80, 0xE7, 0x00,
+    0x01, 0xF7, 0x08, 0xF6, 0x23, 0xBE, 0x20, 0x08, 0xEF, 0xFC, 0x30, 0x00, 0x00, 0x21, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x71, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x9C, 0xF3, 0x00, 0x00, 0x5E,
+    0x2F, 0x30, 0x00, 0x2E, 0x50, 0xF3, 0x00, 0x0C, 0x90, 0x0F, 0x30, 0x09, 0xC1, 0x00, 0xF3, 0x05,
+    0xF4, 0x22, 0x2F, 0x52, 0x8F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x00, 0x00,
+    0xF3, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x00, 0x47, 0x77, 0x75, 0x00, 0x0C, 0xED, 0xDD, 0x90, 0x00,
+    0xE4, 0x00, 0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, 0x04, 0xE4, 0x53, 0x00, 0x00, 0x7F, 0xED, 0xFD,
+    0x20, 0x00, 0x10, 0x02, 0xDC, 0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, 0x00, 0x4F, 0x20, 0x00,
+    0x00, 0x08, 0xE0, 0x0B, 0x83, 0x27, 0xF6, 0x00, 0x6D, 0xFF, 0xD6, 0x00, 0x00, 0x01, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, 0x02, 0xEA, 0x00, 0x00, 0x00,
+    0xBC, 0x10, 0x00, 0x00, 0x8E, 0x20, 0x00, 0x00, 0x3F, 0xDE, 0xFC, 0x30, 0x0B, 0xE6, 0x13, 0xBE,
+    0x21, 0xF7, 0x00, 0x01, 0xF7, 0x2F, 0x40, 0x00, 0x0D, 0x90, 0xE6, 0x00, 0x01, 0xF6, 0x08, 0xE5,
+    0x13, 0xBD, 0x10, 0x08, 0xEF, 0xFB, 0x20, 0x00, 0x00, 0x21, 0x00, 0x00, 0x17, 0x77, 0x77, 0x77,
+    0x41, 0xDD, 0xDD, 0xDD, 0xF9, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00,
+    0x04, 0xF3, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x0B, 0xB0, 0x00,
+    0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x0C, 0xA0,
+    0x00, 0x00, 0x00, 0x17, 0x87, 0x20, 0x00, 0x2E, 0xC8, 0xAF, 0x50, 0x0A, 0xC0, 0x00, 0x8E, 0x00,
+    0xC9, 0x00, 0x05, 0xF1, 0x09, 0xC0, 0x00, 0x8D, 0x00, 0x1C, 0xC8, 0xAD, 0x40, 0x03, 0xCD, 0xAB,
+    0xD5, 0x00, 0xDA, 0x00, 0x06, 0xF3, 0x3F, 0x40, 0x00, 0x0F, 0x72, 0xF5, 0x00, 0x01, 0xF6, 0x0C,
+    0xD4, 0x02, 0xBE, 0x10, 0x1A, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x58, 0x84,
+    0x00, 0x0B, 0xEA, 0xAF, 0xA0, 0x7E, 0x20, 0x03, 0xF5, 0xCA, 0x00, 0x00, 0xC9, 0xCA, 0x00, 0x00,
+    0xC9, 0x7E, 0x30, 0x06, 0xF6, 0x1B, 0xFD, 0xDE, 0xE1, 0x00, 0x34, 0x4E, 0x60, 0x00, 0x01, 0xDA,
+    0x00, 0x00, 0x0A, 0xE1, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x03, 0xF9, 0x00, 0x00, 0xAA, 0x0D, 0xD0,
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x0D, 0xD0, 0x11, 0x00, 0xAA, 0x0D, 0xD0, 0x11, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xAA, 0x0B, 0xF0, 0x1A, 0x09, 0x30, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40,
+    0x00, 0x6D, 0xD3, 0x05, 0xDD, 0x50, 0x0B, 0xF7, 0x00, 0x00, 0x29, 0xE9, 0x20, 0x00, 0x02, 0xAF,
+    0x91, 0x00, 0x00, 0x2A, 0x60, 0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x40, 0xAC, 0xCC, 0xCC, 0xC1,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x88, 0x88, 0x81, 0x68, 0x88, 0x88, 0x81, 0x19, 0x10, 0x00, 0x00,
+    0x0A, 0xE8, 0x10, 0x00, 0x00, 0x3B, 0xE8, 0x10, 0x00, 0x00, 0x4E, 0xE1, 0x00, 0x17, 0xEB, 0x30,
+    0x07, 0xEC, 0x40, 0x00, 0x1C, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x50, 0x07,
+    0xE9, 0xAF, 0x80, 0x21, 0x00, 0x6F, 0x10, 0x00, 0x05, 0xF1, 0x00, 0x01, 0xCA, 0x00, 0x03, 0xDA,
+    0x10, 0x00, 0xAA, 0x00, 0x00, 0x0A, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xC8, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xDD, 0xA4, 0x00,
+    0x00, 0x02, 0xCA, 0x41, 0x24, 0xBA, 0x10, 0x01, 0xD6, 0x00, 0x00, 0x00, 0x8A, 0x00, 0x98, 0x00,
+    0x05, 0x88, 0x30, 0xD2, 0x1E, 0x10, 0x2D, 0x96, 0xD5, 0x09, 0x64, 0xC0, 0x0B, 0x70, 0x0E, 0x10,
+    0x88, 0x5B, 0x02, 0xE1, 0x04, 0xD0, 0x09, 0x64, 0xC0, 0x3E, 0x00, 0x9A, 0x01, 0xD2, 0x1E, 0x11,
+    0xE9, 0x9B, 0xD6, 0xC7, 0x00, 0xA8, 0x02, 0x75, 0x04, 0x73, 0x00, 0x02, 0xE5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xDA, 0x41, 0x12, 0x5B, 0x70, 0x00, 0x01, 0x6B, 0xDE, 0xC9, 0x40, 0x00, 0x00,
+    0x00, 0x37, 0x20, 0x00, 0x00, 0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x02, 0xFB, 0xE1, 0x00, 0x00,
+    0x00, 0x8E, 0x2F, 0x60, 0x00, 0x00, 0x0E, 0x80, 0xAC, 0x00, 0x00, 0x05, 0xF3, 0x04, 0xF3, 0x00,
+    0x00, 0xBC, 0x00, 0x0D, 0x90, 0x00, 0x2F, 0x94, 0x44, 0xAE, 0x10, 0x08, 0xFD, 0xDD, 0xDD, 0xF6,
+    0x00, 0xEA, 0x00, 0x00, 0x0B, 0xC0, 0x5F, 0x40, 0x00, 0x00, 0x5F, 0x3B, 0xC0, 0x00, 0x00, 0x00,
+    0xE9, 0x47, 0x77, 0x75, 0x10, 0x09, 0xFB, 0xBC, 0xEE, 0x50, 0x9E, 0x00, 0x01, 0xCE, 0x09, 0xE0,
+    0x00, 0x07, 0xF1, 0x9E, 0x00, 0x00, 0xAD, 0x09, 0xE5, 0x55, 0xAD, 0x30, 0x9F, 0xBB, 0xCE, 0xB4,
+    0x09, 0xE0, 0x00, 0x08, 0xF3, 0x9E, 0x00, 0x00, 0x1F, 0x79, 0xE0, 0x00, 0x03, 0xF6, 0x9E, 0x44,
+    0x46, 0xDD, 0x19, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00, 0x48, 0x88, 0x40, 0x00, 0x03, 0xDF, 0xDB,
+    0xDF, 0xB1, 0x02, 0xED, 0x30, 0x00, 0x39, 0x00, 0xAE, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00,
+    0x00, 0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x03, 0xF6, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, 0x30, 0x00, 0xBF,
+    0x94, 0x35, 0xBE, 0x20, 0x00, 0x7D, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x47,
+    0x77, 0x76, 0x30, 0x00, 0x09, 0xFC, 0xCC, 0xDF, 0xC3, 0x00, 0x9E, 0x00, 0x00, 0x3C, 0xE2, 0x09,
+    0xE0, 0x00, 0x00, 0x1E, 0xB0, 0x9E, 0x00, 0x00, 0x00, 0x8F, 0x29, 0xE0, 0x00, 0x00, 0x05, 0xF4,
+    0x9E, 0x00, 0x00, 0x00, 0x4F, 0x59, 0xE0, 0x00, 0x00, 0x06, 0xF3, 0x9E, 0x00, 0x00, 0x00, 0xAE,
+    0x09, 0xE0, 0x00, 0x00, 0x5F, 0x70, 0x9E, 0x44, 0x45, 0xAF, 0xA0, 0x09, 0xFF, 0xFF, 0xEB, 0x50,
+    0x00, 0x47, 0x77, 0x77, 0x73, 0x9F, 0xCC, 0xCC, 0xC6, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x00, 0x9F, 0x66, 0x66, 0x20, 0x9F, 0xCC, 0xCC, 0x50, 0x9E, 0x00, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x44, 0x44, 0x42, 0x9F, 0xFF, 0xFF,
+    0xF7, 0x47, 0x77, 0x77, 0x73, 0x9F, 0xCC, 0xCC, 0xC6, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x33, 0x33, 0x20, 0x9F, 0xFF, 0xFF, 0xA0, 0x9E, 0x11, 0x11,
+    0x10, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x48, 0x88, 0x51, 0x00, 0x03, 0xDF, 0xDB, 0xCF, 0xE4, 0x02, 0xED, 0x30, 0x00,
+    0x29, 0x40, 0xAE, 0x20, 0x00, 0x00, 0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x04, 0xF5, 0x00, 0x00,
+    0x00, 0x00, 0x4F, 0x50, 0x00, 0x06, 0x88, 0x63, 0xF6, 0x00, 0x00, 0x8A, 0xDB, 0x0D, 0xB0, 0x00,
+    0x00, 0x0A, 0xB0, 0x7F, 0x60, 0x00, 0x00, 0xAB, 0x00, 0xAF, 0x94, 0x23, 0x7E, 0xB0, 0x00, 0x6D,
+    0xFF, 0xFE, 0x92, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x65, 0x9E, 0x00,
+    0x00, 0x00, 0xDA, 0x9E, 0x00, 0x00, 0x00, 0xDA, 0x9E, 0x00, 0x00, 0x00, 0xDA, 0x9E, 0x00, 0x00,
+    0x00, 0xDA, 0x9F, 0x66, 0x66, 0x66, 0xEA, 0x9F, 0xCC, 0xCC, 0xCC, 0xFA, 0x9E, 0x00, 0x00, 0x00,
+    0xDA, 0x9E, 0x00, 0x00, 0x00, 0xDA, 0x9E, 0x00, 0x00, 0x00, 0xDA, 0x9E, 0x00, 0x00, 0x00, 0xDA,
+    0x9E, 0x00, 0x00, 0x00, 0xDA, 0x27, 0x25, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35,
+    0xF3, 0x5F, 0x35, 0xF3, 0x5F, 0x35, 0xF3, 0x00, 0x00, 0x65, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xDB,
+    0x00, 0x00, 0xDB, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xDB, 0x00,
+    0x00, 0xDA, 0x00, 0x01, 0xF8, 0x23, 0x4B, 0xF2, 0x7F, 0xFD, 0x50, 0x01, 0x20, 0x00, 0x37, 0x10,
+    0x00, 0x04, 0x71, 0x7F, 0x10, 0x00, 0x4F, 0x80, 0x7F, 0x10, 0x02, 0xEA, 0x00, 0x7F, 0x10, 0x1D,
+    0xB0, 0x00, 0x7F, 0x11, 0xCC, 0x10, 0x00, 0x7F, 0x7C, 0xD2, 0x00, 0x00, 0x7F, 0xCE, 0xE2, 0x00,
+    0x00, 0x7F, 0x11, 0xDD, 0x10, 0x00, 0x7F, 0x10, 0x2E, 0xB0, 0x00, 0x7F, 0x10, 0x04, 0xF9, 0x00,
+    0x7F, 0x10, 0x00, 0x5F, 0x70, 0x7F, 0x10, 0x00, 0x07, 0xF4, 0x46, 0x00, 0x00, 0x09, 0xE0, 0x00,
+    0x00, 0x9E, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x9E,
+    0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x09, 0xE0, 0x00, 0x00, 0x9E, 0x55, 0x55,
+    0x49, 0xFF, 0xFF, 0xFE, 0x46, 0x00, 0x00, 0x00, 0x00, 0x27, 0x29, 0xF7, 0x00, 0x00, 0x00, 0x0B,
+    0xF5, 0x9F, 0xE1, 0x00, 0x00, 0x04, 0xFF, 0x59, 0xCD, 0x90, 0x00, 0x00, 0xCA, 0xF5, 0x9B, 0x5F,
+    0x20, 0x00, 0x6E, 0x2F, 0x59, 0xB0, 0xCB, 0x00, 0x1E, 0x81, 0xF5, 0x9B, 0x03, 0xF4, 0x07, 0xE1,
+    0x1F, 0x59, 0xB0, 0x0A, 0xC2, 0xE6, 0x01, 0xF5, 0x9B, 0x00, 0x2F, 0xCD, 0x00, 0x1F, 0x59, 0xB0,
+    0x00, 0x8F, 0x50, 0x01, 0xF5, 0x9B, 0x00, 0x01, 0x50, 0x00, 0x1F, 0x59, 0xB0, 0x00, 0x00, 0x00,
+    0x01, 0xF5, 0x45, 0x00, 0x00, 0x00, 0x45, 0x9F, 0x40, 0x00, 0x00, 0xAA, 0x9F, 0xE2, 0x00, 0x00,
+    0xAA, 0x9C, 0xDC, 0x00, 0x00, 0xAA, 0x9B, 0x3F, 0x90, 0x00, 0xAA, 0x9B, 0x06, 0xF5, 0x00, 0xAA,
+    0x9B, 0x00, 0xAE, 0x20, 0xAA, 0x9B, 0x00, 0x1D, 0xC1, 0xAA, 0x9B, 0x00, 0x02, 0xEA, 0xAA, 0x9B,
+    0x00, 0x00, 0x5F, 0xEA, 0x9B, 0x00, 0x00, 0x09, 0xFA, 0x9B, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00,
+    0x58, 0x87, 0x30, 0x00, 0x00, 0x03, 0xDF, 0xDB, 0xDF, 0xB1, 0x00, 0x02, 0xEC, 0x30, 0x00, 0x4E,
+    0xC0, 0x00, 0xAE, 0x10, 0x00, 0x00, 0x4F, 0x70, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xCC, 0x03, 0xF6,
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x4F, 0x50, 0x00, 0x00, 0x00, 0x8F, 0x02, 0xF7, 0x00, 0x00, 0x00,
+    0x0A, 0xE0, 0x0D, 0xB0, 0x00, 0x00, 0x01, 0xEA, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x9F, 0x30, 0x00,
+    0xAF, 0xA5, 0x45, 0xBF, 0x70, 0x00, 0x00, 0x6D, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x01, 0x20,
+    0x00, 0x00, 0x00, 0x37, 0x77, 0x64, 0x00, 0x07, 0xFC, 0xBC, 0xFD, 0x30, 0x7F, 0x10, 0x02, 0xDD,
+    0x07, 0xF1, 0x00, 0x06, 0xF2, 0x7F, 0x10, 0x00, 0x6F, 0x37, 0xF1, 0x00, 0x0C, 0xE0, 0x7F, 0x88,
+    0x8D, 0xF5, 0x07, 0xFB, 0xAA, 0x82, 0x00, 0x7F, 0x10, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00,
+    0x7F, 0x10, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x87, 0x30, 0x00, 0x00,
+    0x03, 0xDF, 0xDB, 0xDF, 0xB1, 0x00, 0x02, 0xEC, 0x30, 0x00, 0x4E, 0xC0, 0x00, 0xAE, 0x10, 0x00,
+    0x00, 0x4F, 0x70, 0x1F, 0x90, 0x00, 0x00, 0x00, 0xCC, 0x03, 0xF6, 0x00, 0x00, 0x00, 0x09, 0xF0,
+    0x4F, 0x50, 0x00, 0x00, 0x00, 0x8F, 0x02, 0xF7, 0x00, 0x00, 0x00, 0x0A, 0xE0, 0x0D, 0xB0, 0x00,
+    0x00, 0x01, 0xEA, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x9F, 0x30, 0x00, 0xAF, 0xA5, 0x45, 0xBF, 0x70,
+    0x00, 0x00, 0x6D, 0xFF, 0xFE, 0xD1, 0x00, 0x00, 0x00, 0x01, 0x20, 0x2D, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x2E, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x20, 0x37, 0x77, 0x64, 0x00, 0x00,
+    0x7F, 0xCB, 0xCF, 0xD3, 0x00, 0x7F, 0x10, 0x02, 0xDB, 0x00, 0x7F, 0x10, 0x00, 0x8F, 0x00, 0x7F,
+    0x10, 0x00, 0x9D, 0x00, 0x7F, 0x10, 0x06, 0xF7, 0x00, 0x7F, 0xEE, 0xFD, 0x60, 0x00, 0x7F, 0x44,
+    0xEA, 0x00, 0x00, 0x7F, 0x10, 0x4F, 0x70, 0x00, 0x7F, 0x10, 0x08, 0xF3, 0x00, 0x7F, 0x10, 0x00,
+    0xCD, 0x10, 0x7F, 0x10, 0x00, 0x2E, 0xA0, 0x00, 0x27, 0x87, 0x30, 0x04, 0xED, 0xAD, 0xF6, 0x0C,
+    0xB0, 0x00, 0x52, 0x0F, 0x60, 0x00, 0x00, 0x0E, 0xC2, 0x00, 0x00, 0x05, 0xFF, 0xA5, 0x00, 0x00,
+    0x28, 0xDF, 0xD2, 0x00, 0x00, 0x05, 0xEB, 0x00, 0x00, 0x00, 0x9D, 0x03, 0x00, 0x00, 0xBB, 0x5F,
+    0x93, 0x38, 0xF5, 0x07, 0xDF, 0xFD, 0x60, 0x00, 0x01, 0x20, 0x00, 0x57, 0x77, 0x77, 0x77, 0x71,
+    0x9C, 0xCC, 0xFE, 0xCC, 0xC2, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00,
+    0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01,
+    0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x00, 0x01, 0xF7,
+    0x00, 0x00, 0x00, 0x01, 0xF7, 0x00, 0x00, 0x55, 0x00, 0x00, 0x01, 0x73, 0xBC, 0x00, 0x00, 0x02,
+    0xF6, 0xBC, 0x00, 0x00, 0x02, 0xF6, 0xBC, 0x00, 0x00, 0x02, 0xF6, 0xBC, 0x00, 0x00, 0x02, 0xF6,
+    0xBC, 0x00, 0x00, 0x02, 0xF6, 0xBC, 0x00, 0x00, 0x02, 0xF6, 0xBC, 0x00, 0x00, 0x02, 0xF6, 0x9E,
+    0x00, 0x00, 0x04, 0xF5, 0x5F, 0x60, 0x00, 0x0A, 0xE1, 0x0B, 0xF8, 0x45, 0xAF, 0x70, 0x01, 0x8E,
+    0xFF, 0xD6, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x06, 0x58, 0xF1, 0x00,
+    0x00, 0x03, 0xF6, 0x2F, 0x70, 0x00, 0x00, 0x9E, 0x10, 0xBD, 0x00, 0x00, 0x1E, 0x90, 0x05, 0xF4,
+    0x00, 0x06, 0xF3, 0x00, 0x0D, 0xA0, 0x00, 0xCC, 0x00, 0x00, 0x8F, 0x10, 0x3F, 0x60, 0x00, 0x02,
+    0xF7, 0x09, 0xE1, 0x00, 0x00, 0x0A, 0xD1, 0xE8, 0x00, 0x00, 0x00, 0x4F, 0x9F, 0x20, 0x00, 0x00,
+    0x00, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x56, 0x00, 0x00, 0x03, 0x60, 0x00,
+    0x00, 0x37, 0x19, 0xF2, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x0B, 0xD0, 0x4F, 0x60, 0x00, 0x2F, 0xF7,
+    0x00, 0x01, 0xF9, 0x00, 0xEA, 0x00, 0x06, 0xE9, 0xC0, 0x00, 0x5F, 0x40, 0x0A, 0xE1, 0x00, 0xC9,
+    0x4F, 0x20, 0x09, 0xE0, 0x00, 0x5F, 0x40, 0x2F, 0x40, 0xE7, 0x00, 0xEA, 0x00, 0x01, 0xF9, 0x07,
+    0xE0, 0x09, 0xD0, 0x3F, 0x50, 0x00, 0x0B, 0xD0, 0xC9, 0x00, 0x4F, 0x38, 0xF1, 0x00, 0x00, 0x6F,
+    0x5F, 0x40, 0x00, 0xE8, 0xCA, 0x00, 0x00, 0x01, 0xFD, 0xE0, 0x00, 0x09, 0xDF, 0x60, 0x00, 0x00,
+    0x0C, 0xF9, 0x00, 0x00, 0x4F, 0xF1, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0xEB, 0x00, 0x00,
+    0x47, 0x10, 0x00, 0x00, 0x56, 0x02, 0xEA, 0x00, 0x00, 0x4F, 0x50, 0x06, 0xF5, 0x00, 0x1D, 0xA0,
+    0x00, 0x0B, 0xE1, 0x0A, 0xE1, 0x00, 0x00, 0x2E, 0xA5, 0xF4, 0x00, 0x00, 0x00, 0x5F, 0xE9, 0x00,
+    0x00, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xDC, 0x8F, 0x30, 0x00, 0x00, 0x8E, 0x20, 0xDC,
+    0x00, 0x00, 0x3F, 0x70, 0x03, 0xF8, 0x00, 0x1D, 0xC0, 0x00, 0x09, 0xF3, 0x08, 0xE2, 0x00, 0x00,
+    0x1D, 0xC0, 0x56, 0x00, 0x00, 0x00, 0x56, 0x05, 0xF5, 0x00, 0x00, 0x4F, 0x60, 0x0B, 0xD1, 0x00,
+    0x0C, 0xC0, 0x00, 0x2F, 0x70, 0x06, 0xF3, 0x00, 0x00, 0x8E, 0x21, 0xE9, 0x00, 0x00, 0x01, 0xDA,
+    0x9E, 0x10, 0x00, 0x00, 0x05, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x00,
+    0x0B, 0xC0, 0x00, 0x00, 0x07, 0x77, 0x77, 0x77, 0x72, 0x0C, 0xCC, 0xCC, 0xCE, 0xF4, 0x00, 0x00,
+    0x00, 0x3F, 0x90, 0x00, 0x00, 0x01, 0xDD, 0x10, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x4F,
+    0x70, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00,
+    0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x0C, 0xE4, 0x44, 0x44, 0x41, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4,
+    0x34, 0x40, 0xDC, 0xA1, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00,
+    0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xD5, 0x00, 0xDB, 0x91, 0x45, 0x50,
+    0x1B, 0x20, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x04, 0xD0, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00,
+    0x00, 0x7B, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x04, 0xD0, 0x00,
+    0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x00, 0x00, 0x0A, 0x80,
+    0x00, 0x00, 0x03, 0x90, 0x14, 0x42, 0x2A, 0xDA, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A,
+    0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A, 0x00, 0x8A,
+    0x29, 0xCA, 0x15, 0x53, 0x00, 0x06, 0x10, 0x00, 0x06, 0xF9, 0x00, 0x01, 0xE8, 0xE2, 0x00, 0x8C,
+    0x09, 0xA0, 0x2E, 0x40, 0x1E, 0x46, 0x80, 0x00, 0x67, 0xAA, 0xAA, 0xAA, 0x34, 0x44, 0x44, 0x41,
+    0x38, 0x20, 0x0A, 0xB0, 0x01, 0x93, 0x00, 0x03, 0x41, 0x00, 0x04, 0xDE, 0xEE, 0x40, 0x08, 0x60,
+    0x0A, 0xD0, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x15, 0x7A, 0xF2, 0x07, 0xEA, 0x78, 0xF2, 0x3F, 0x40,
+    0x04, 0xF2, 0x3F, 0x40, 0x2B, 0xF2, 0x09, 0xFD, 0xC4, 0xF2, 0x00, 0x11, 0x00, 0x00, 0xA8, 0x00,
+    0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x02, 0x31, 0x00, 0xCA, 0xAE,
+    0xFE, 0x40, 0xCE, 0x50, 0x1B, 0xD0, 0xCA, 0x00, 0x04, 0xF4, 0xCA, 0x00, 0x02, 0xF5, 0xCA, 0x00,
+    0x02, 0xF5, 0xCA, 0x00, 0x05, 0xF2, 0xCE, 0x40, 0x3D, 0xA0, 0xC9, 0xBF, 0xFA, 0x10, 0x00, 0x01,
+    0x10, 0x00, 0x00, 0x02, 0x31, 0x00, 0x02, 0xCF, 0xDF, 0x90, 0x0C, 0xC2, 0x02, 0x50, 0x3F, 0x40,
+    0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0x0B, 0xD3,
+    0x03, 0xA0, 0x01, 0xAF, 0xFE, 0x70, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00,
+    0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x03, 0x30, 0xBB, 0x02, 0xDF, 0xDD, 0xDB, 0x0C, 0xC1,
+    0x02, 0xDB, 0x3F, 0x40, 0x00, 0xBB, 0x6F, 0x10, 0x00, 0xBB, 0x6F, 0x10, 0x00, 0xBB, 0x4F, 0x40,
+    0x00, 0xBB, 0x0D, 0xC2, 0x17, 0xEB, 0x03, 0xDF, 0xE8, 0x8B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02,
+    0x31, 0x00, 0x02, 0xBE, 0xCE, 0x80, 0x0C, 0xB1, 0x02, 0xE5, 0x3F, 0x30, 0x00, 0x9A, 0x6F, 0xDD,
+    0xDD, 0xEA, 0x5F, 0x10, 0x00, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x0A, 0xD4, 0x02, 0x95, 0x01, 0x9F,
+    0xFF, 0xA2, 0x00, 0x00, 0x20, 0x00, 0x00, 0x28, 0x92, 0x01, 0xEB, 0x72, 0x06, 0xE1, 0x00, 0x08,
+    0xD0, 0x00, 0xBF, 0xFE, 0xE3, 0x08, 0xE1, 0x10, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0,
+    0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x13, 0x30, 0x00, 0x05, 0xED,
+    0xDE, 0xCB, 0x1E, 0x60, 0x09, 0xD1, 0x2F, 0x20, 0x05, 0xE0, 0x0D, 0x90, 0x1B, 0xA0, 0x04, 0xEE,
+    0xE9, 0x10, 0x0C, 0x60, 0x00, 0x00, 0x0B, 0xEC, 0xA9, 0x60, 0x2B, 0x76, 0x79, 0xE9, 0x8A, 0x00,
+    0x00, 0x9A, 0x6E, 0x62, 0x26, 0xE4, 0x06, 0xBE, 0xDA, 0x40, 0xA7, 0x00, 0x00, 0x0C, 0x90, 0x00,
+    0x00, 0xC9, 0x00, 0x00, 0x0C, 0x90, 0x23, 0x00, 0xCA, 0xBE, 0xFD, 0x2C, 0xE4, 0x01, 0xDA, 0xC9,
+    0x00, 0x08, 0xDC, 0x90, 0x00, 0x8E, 0xC9, 0x00, 0x08, 0xEC, 0x90, 0x00, 0x8E, 0xC9, 0x00, 0x08,
+    0xEC, 0x90, 0x00, 0x8E, 0x68, 0x0E, 0xF1, 0x33, 0x01, 0x10, 0xAB, 0x0A, 0xB0, 0xAB, 0x0A, 0xB0,
+    0xAB, 0x0A, 0xB0, 0xAB, 0x0A, 0xB0, 0x00, 0x68, 0x00, 0x0E, 0xF1, 0x00, 0x33, 0x00, 0x01, 0x10,
+    0x00, 0xAB, 0x00, 0x0A, 0xB0, 0x00, 0xAB, 0x00, 0x0A, 0xB0, 0x00, 0xAB, 0x00, 0x0A, 0xB0, 0x00,
+    0xAB, 0x00, 0x0A, 0xB0, 0x00, 0xAB, 0x01, 0x3D, 0x90, 0x5D, 0xB1, 0x00, 0xA8, 0x00, 0x00, 0x00,
+    0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, 0xCA, 0x00, 0x01, 0x20, 0xCA, 0x00, 0x4E, 0x60,
+    0xCA, 0x03, 0xE6, 0x00, 0xCA, 0x2E, 0x70, 0x00, 0xCE, 0xEB, 0x00, 0x00, 0xCA, 0x5F, 0x50, 0x00,
+    0xCA, 0x07, 0xE3, 0x00, 0xCA, 0x00, 0xAD, 0x10, 0xCA, 0x00, 0x1C, 0xB0, 0x89, 0xAB, 0xAB, 0xAB,
+    0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0xAB, 0x20, 0x03, 0x20, 0x01, 0x31, 0x00, 0xC8, 0xCE,
+    0xF5, 0x7E, 0xEF, 0x50, 0xCD, 0x30, 0x6E, 0xC1, 0x0A, 0xE0, 0xC9, 0x00, 0x1F, 0x60, 0x05, 0xF2,
+    0xC9, 0x00, 0x1F, 0x50, 0x04, 0xF2, 0xC9, 0x00, 0x1F, 0x50, 0x04, 0xF2, 0xC9, 0x00, 0x1F, 0x50,
+    0x04, 0xF2, 0xC9, 0x00, 0x1F, 0x50, 0x04, 0xF2, 0xC9, 0x00, 0x1F, 0x50, 0x04, 0xF2, 0x20, 0x02,
+    0x30, 0x0C, 0x8B, 0xEF, 0xD2, 0xCE, 0x40, 0x1D, 0xAC, 0x90, 0x00, 0x8D, 0xC9, 0x00, 0x08, 0xEC,
+    0x90, 0x00, 0x8E, 0xC9, 0x00, 0x08, 0xEC, 0x90, 0x00, 0x8E, 0xC9, 0x00, 0x08, 0xE0, 0x00, 0x02,
+    0x32, 0x00, 0x00, 0x2B, 0xFD, 0xFA, 0x10, 0x0C, 0xC1, 0x02, 0xDA, 0x03, 0xF4, 0x00, 0x06, 0xF2,
+    0x6F, 0x10, 0x00, 0x3F, 0x46, 0xF1, 0x00, 0x03, 0xF4, 0x3F, 0x40, 0x00, 0x6F, 0x10, 0xBD, 0x30,
+    0x4E, 0x90, 0x01, 0xAF, 0xFE, 0x90, 0x00, 0x00, 0x02, 0x00, 0x00, 0x20, 0x02, 0x31, 0x00, 0xC7,
+    0xBE, 0xFE, 0x30, 0xCE, 0x40, 0x1C, 0xD0, 0xC9, 0x00, 0x05, 0xF3, 0xC9, 0x00, 0x03, 0xF4, 0xC9,
+    0x00, 0x03, 0xF4, 0xC9, 0x00, 0x06, 0xF1, 0xCD, 0x30, 0x3E, 0xA0, 0xCB, 0xCF, 0xFA, 0x10, 0xC9,
+    0x01, 0x10, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x11, 0x02,
+    0xDF, 0xDD, 0xBB, 0x0C, 0xC1, 0x02, 0xDB, 0x3F, 0x40, 0x00, 0xBB, 0x6F, 0x10, 0x00, 0xBB, 0x6F,
+    0x10, 0x00, 0xBB, 0x4F, 0x40, 0x00, 0xBB, 0x0D, 0xC2, 0x17, 0xFB, 0x03, 0xDF, 0xE8, 0xBB, 0x00,
+    0x02, 0x00, 0xBB, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x88, 0x20, 0x03, 0x30, 0xC7, 0xAF,
+    0xF0, 0xCE, 0x93, 0x30, 0xCB, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xC9, 0x00, 0x00, 0xC9, 0x00, 0x00,
+    0xC9, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, 0x13, 0x20, 0x00, 0x8F, 0xDE, 0xB0, 0x3F, 0x40, 0x14,
+    0x04, 0xF5, 0x00, 0x00, 0x0A, 0xFC, 0x71, 0x00, 0x03, 0x8E, 0xD1, 0x00, 0x00, 0x2F, 0x42, 0x71,
+    0x06, 0xF1, 0x2C, 0xFE, 0xE5, 0x00, 0x01, 0x20, 0x00, 0x00, 0xB1, 0x00, 0x02, 0xF1, 0x00, 0x04,
+    0xF1, 0x00, 0x8E, 0xFE, 0xE5, 0x16, 0xF2, 0x10, 0x06, 0xF1, 0x00, 0x06, 0xF1, 0x00, 0x06, 0xF1,
+    0x00, 0x06, 0xF1, 0x00, 0x05, 0xF4, 0x31, 0x01, 0xCF, 0xE5, 0x00, 0x02, 0x00, 0x02, 0x10, 0x00,
+    0x11, 0x0F, 0x60, 0x00, 0xBB, 0x0F, 0x60, 0x00, 0xBB, 0x0F, 0x60, 0x00, 0xBB, 0x0F, 0x60, 0x00,
+    0xBB, 0x0F, 0x60, 0x00, 0xBB, 0x0F, 0x70, 0x00, 0xBB, 0x0C, 0xC2, 0x17, 0xFB, 0x03, 0xDF, 0xF9,
+    0x8B, 0x00, 0x02, 0x10, 0x00, 0x21, 0x00, 0x00, 0x02, 0x09, 0xD0, 0x00, 0x09, 0xC0, 0x3F, 0x40,
+    0x01, 0xE6, 0x00, 0xCA, 0x00, 0x6E, 0x10, 0x06, 0xF1, 0x0C, 0x90, 0x00, 0x1E, 0x73, 0xF2, 0x00,
+    0x00, 0x9C, 0x9B, 0x00, 0x00, 0x02, 0xFE, 0x50, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x21, 0x00,
+    0x01, 0x10, 0x00, 0x02, 0x0A, 0xB0, 0x00, 0xAE, 0x10, 0x06, 0xE0, 0x6F, 0x10, 0x0E, 0xE5, 0x00,
+    0xB9, 0x01, 0xF5, 0x04, 0xD9, 0x90, 0x1F, 0x50, 0x0B, 0xA0, 0x98, 0x4E, 0x05, 0xE0, 0x00, 0x6E,
+    0x1E, 0x30, 0xE4, 0xAA, 0x00, 0x01, 0xF8, 0xD0, 0x09, 0x9E, 0x50, 0x00, 0x0B, 0xE8, 0x00, 0x4E,
+    0xE1, 0x00, 0x00, 0x6F, 0x30, 0x00, 0xEA, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x4F, 0x50, 0x03,
+    0xF4, 0x08, 0xE1, 0x1D, 0x90, 0x00, 0xDA, 0x8D, 0x10, 0x00, 0x3F, 0xF3, 0x00, 0x00, 0x6E, 0xE7,
+    0x00, 0x02, 0xE6, 0x6F, 0x30, 0x0B, 0xB0, 0x0B, 0xC0, 0x7E, 0x20, 0x02, 0xE7, 0x21, 0x00, 0x00,
+    0x02, 0x09, 0xD0, 0x00, 0x09, 0xC0, 0x3F, 0x50, 0x01, 0xE6, 0x00, 0xBB, 0x00, 0x7E, 0x00, 0x05,
+    0xF3, 0x0D, 0x80, 0x00, 0x0D, 0x94, 0xF2, 0x00, 0x00, 0x6E, 0xBA, 0x00, 0x00, 0x01, 0xEF, 0x30,
+    0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x0A,
+    0x60, 0x00, 0x00, 0x02, 0x22, 0x22, 0x23, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0x40, 0x00, 0x1D,
+    0x80, 0x00, 0x0A, 0xC0, 0x00, 0x07, 0xE2, 0x00, 0x03, 0xF4, 0x00, 0x01, 0xD9, 0x22, 0x21, 0x6F,
+    0xFF, 0xFF, 0xA0, 0x00, 0x14, 0x00, 0x5E, 0xA1, 0x0D, 0x60, 0x00, 0xE5, 0x00, 0x0C, 0x60, 0x00,
+    0xA9, 0x00, 0x09, 0xA0, 0x05, 0xD4, 0x00, 0x5D, 0x30, 0x00, 0x99, 0x00, 0x0A, 0x90, 0x00, 0xC6,
+    0x00, 0x0E, 0x50, 0x00, 0xD6, 0x00, 0x05, 0xEA, 0x10, 0x02, 0x50, 0x14, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2B, 0x14, 0x10, 0x03, 0xBE, 0x30,
+    0x00, 0x9A, 0x00, 0x08, 0xB0, 0x00, 0x99, 0x00, 0x0C, 0x70, 0x00, 0xD6, 0x00, 0x06, 0xC3, 0x00,
+    0x6C, 0x30, 0x0C, 0x60, 0x00, 0xC7, 0x00, 0x09, 0x90, 0x00, 0x8B, 0x00, 0x09, 0xA0, 0x3A, 0xE3,
+    0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x2A, 0xB6, 0x11, 0xE4, 0x0C, 0xB8, 0xDF, 0xEC,
+    0x01, 0xA1, 0x00, 0x33, 0x00,
+};
+
+static const SSD1963_Glyph lato16_glyphs[] = {
+    // offset, w, h, x_off, y_off, advance
+    {      0,   0,   0,    0,    0,   3 },  // ' '
+    {      0,   3,  13,    1,  -12,   5 },  // '!'
+    {     20,   5,   5,    1,  -12,   6 },  // '"'
+    {     33,   9,  12,    0,  -12,   9 },  // '#'
+    {     87,   9,  16,    0,  -14,   9 },  // '$'
+    {    159,  12,  13,    0,  -12,  13 },  // '%'
+    {    237,  12,  13,    0,  -12,  11 },  // '&'
+    {    315,   2,   5,    1,  -12,   4 },  // '''
+    {    320,   4,  16,    1,  -13,   5 },  // '('
+    {    352,   4,  16,    0,  -13,   5 },  // ')'
+    {    384,   6,   7,    0,  -13,   6 },  // '*'
+    {    405,   9,   9,    0,  -10,   9 },  // '+'
+    {    446,   3,   5,    0,   -2,   3 },  // ','
+    {    454,   5,   2,    0,   -6,   6 },  // '-'
+    {    459,   3,   3,    0,   -2,   3 },  // '.'
+    {    464,   8,  13,   -1,  -12,   6 },  // '/'
+    {    516,   9,  13,    0,  -12,   9 },  // '0'
+    {    575,   8,  12,    1,  -12,   9 },  // '1'
+    {    623,   9,  12,    0,  -12,   9 },  // '2'
+    {    677,   9,  13,    0,  -12,   9 },  // '3'
+    {    736,   9,  12,    0,  -12,   9 },  // '4'
+    {    790,   9,  13,    0,  -12,   9 },  // '5'
+    {    849,   9,  13,    0,  -12,   9 },  // '6'
+    {    908,   9,  12,    0,  -12,   9 },  // '7'
+    {    962,   9,  13,    0,  -12,   9 },  // '8'
+    {   1021,   8,  12,    1,  -12,   9 },  // '9'
+    {   1069,   3,   9,    1,   -8,   4 },  // ':'
+    {   1083,   3,  11,    1,   -8,   4 },  // ';'
+    {   1100,   7,   8,    1,   -9,   9 },  // '<'
+    {   1128,   8,   5,    1,   -8,   9 },  // '='
+    {   1148,   8,   8,    1,   -9,   9 },  // '>'
+    {   1180,   7,  13,    0,  -12,   6 },  // '?'
+    {   1226,  13,  13,    0,  -11,  13 },  // '@'
+    {   1311,  11,  12,    0,  -12,  11 },  // 'A'
+    {   1377,   9,  12,    1,  -12,  10 },  // 'B'
+    {   1431,  11,  13,    0,  -12,  11 },  // 'C'
+    {   1503,  11,  12,    1,  -12,  12 },  // 'D'
+    {   1569,   8,  12,    1,  -12,   9 },  // 'E'
+    {   1617,   8,  12,    1,  -12,   9 },  // 'F'
+    {   1665,  11,  13,    0,  -12,  12 },  // 'G'
+    {   1737,  10,  12,    1,  -12,  12 },  // 'H'
+    {   1797,   3,  12,    1,  -12,   5 },  // 'I'
+    {   1815,   6,  13,    0,  -12,   7 },  // 'J'
+    {   1854,  10,  12,    1,  -12,  11 },  // 'K'
+    {   1914,   7,  12,    1,  -12,   8 },  // 'L'
+    {   1956,  13,  12,    1,  -12,  15 },  // 'M'
+    {   2034,  10,  12,    1,  -12,  12 },  // 'N'
+    {   2094,  13,  13,    0,  -12,  13 },  // 'O'
+    {   2179,   9,  12,    1,  -12,  10 },  // 'P'
+    {   2233,  13,  15,    0,  -12,  13 },  // 'Q'
+    {   2331,  10,  12,    1,  -12,  10 },  // 'R'
+    {   2391,   8,  13,    0,  -12,   8 },  // 'S'
+    {   2443,  10,  12,    0,  -12,   9 },  // 'T'
+    {   2503,  10,  13,    1,  -12,  12 },  // 'U'
+    {   2568,  11,  12,    0,  -12,  11 },  // 'V'
+    {   2634,  17,  12,    0,  -12,  16 },  // 'W'
+    {   2736,  11,  12,    0,  -12,  10 },  // 'X'
+    {   2802,  11,  12,    0,  -12,  10 },  // 'Y'
+    {   2868,  10,  12,    0,  -12,  10 },  // 'Z'
+    {   2928,   4,  16,    1,  -13,   5 },  // '['
+    {   2960,   8,  13,   -1,  -12,   6 },  // '\\'
+    {   3012,   4,  16,    0,  -13,   5 },  // ']'
+    {   3044,   7,   6,    1,  -12,   9 },  // '^'
+    {   3065,   7,   2,    0,    1,   6 },  // '_'
+    {   3072,   4,   3,    0,  -12,   5 },  // '`'
+    {   3078,   8,  10,    0,   -9,   8 },  // 'a'
+    {   3118,   8,  13,    1,  -12,   9 },  // 'b'
+    {   3170,   8,  10,    0,   -9,   7 },  // 'c'
+    {   3210,   8,  13,    0,  -12,   9 },  // 'd'
+    {   3262,   8,  10,    0,   -9,   8 },  // 'e'
+    {   3302,   6,  12,    0,  -12,   5 },  // 'f'
+    {   3338,   8,  12,    0,   -9,   8 },  // 'g'
+    {   3386,   7,  12,    1,  -12,   9 },  // 'h'
+    {   3428,   3,  12,    1,  -12,   4 },  // 'i'
+    {   3446,   5,  15,   -1,  -12,   4 },  // 'j'
+    {   3484,   8,  12,    1,  -12,   8 },  // 'k'
+    {   3532,   2,  12,    1,  -12,   4 },  // 'l'
+    {   3544,  12,   9,    1,   -9,  13 },  // 'm'
+    {   3598,   7,   9,    1,   -9,   9 },  // 'n'
+    {   3630,   9,  10,    0,   -9,   9 },  // 'o'
+    {   3675,   8,  12,    1,   -9,   9 },  // 'p'
+    {   3723,   8,  12,    0,   -9,   9 },  // 'q'
+    {   3771,   6,   9,    1,   -9,   6 },  // 'r'
+    {   3798,   7,  10,    0,   -9,   7 },  // 's'
+    {   3833,   6,  12,    0,  -11,   6 },  // 't'
+    {   3869,   8,  10,    0,   -9,   9 },  // 'u'
+    {   3909,   9,   9,    0,   -9,   8 },  // 'v'
+    {   3950,  13,   9,    0,   -9,  12 },  // 'w'
+    {   4009,   8,   9,    0,   -9,   8 },  // 'x'
+    {   4045,   9,  12,    0,   -9,   8 },  // 'y'
+    {   4099,   7,   9,    0,   -9,   7 },  // 'z'
+    {   4131,   5,  16,    0,  -13,   5 },  // '{'
+    {   4171,   2,  16,    1,  -13,   5 },  // '|'
+    {   4187,   5,  16,    0,  -13,   5 },  // '}'
+    {   4227,   9,   4,    0,   -7,   9 },  // '~'
+};
+
+const SSD1963_Font font_lato16 = {
+    lato16_bitmap,
+    lato16_glyphs,
+    32, 126,  // first, last
+    4,  // bpp
+    20, 16  // line height, ascent
+};
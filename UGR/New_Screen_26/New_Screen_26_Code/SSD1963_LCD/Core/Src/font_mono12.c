@@ -0,0 +1,189 @@
+// Generated by Host/Tools/fontgen.py from SourceCodePro-Regular.ttf, do not edit.
+//   fontgen.py SourceCodePro-Regular.ttf 12 --bpp 2 --name mono12
+// 95 glyphs, 1189 bitmap bytes, line height 16 px
+#include "ssd1963_font.h"
+
+static const uint8_t mono12_bitmap[] = {
+    0x00, 0xC3, 0x08, 0x20, 0x80, 0x09, 0x74, 0x00, 0x11, 0x1C, 0xA6, 0x29, 0x85, 0x11, 0x40, 0x14,
+    0x42, 0x14, 0x7A, 0x82, 0x24, 0x22, 0x0A, 0xB8, 0x22, 0x05, 0x20, 0x08, 0x01, 0x90, 0x66, 0x89,
+    0x00, 0x79, 0x00, 0x68, 0x00, 0xC9, 0x5C, 0x1D, 0x00, 0x80, 0x04, 0x00, 0x28, 0x06, 0x58, 0x98,
+    0x25, 0x1A, 0x40, 0x00, 0xA4, 0x65, 0x26, 0x14, 0x90, 0x29, 0x00, 0x00, 0x00, 0x00, 0x29, 0x02,
+    0x48, 0x05, 0x90, 0x1D, 0x04, 0xA4, 0x66, 0x26, 0x58, 0x38, 0x2A, 0xA8, 0x00, 0x00, 0x10, 0xD3,
+    0x4C, 0x20, 0x05, 0x08, 0x24, 0x60, 0x50, 0x50, 0x50, 0x60, 0x20, 0x18, 0x05, 0x00, 0x50, 0x24,
+    0x08, 0x09, 0x06, 0x06, 0x06, 0x05, 0x08, 0x18, 0x60, 0x00, 0x04, 0x00, 0x80, 0xAE, 0x81, 0xE0,
+    0x22, 0x01, 0x04, 0x08, 0x00, 0x80, 0x5D, 0x45, 0xD4, 0x08, 0x00, 0x80, 0x24, 0xE1, 0x89, 0x40,
+    0x55, 0x45, 0x54, 0x35, 0xD0, 0x00, 0x00, 0x40, 0x18, 0x02, 0x40, 0x20, 0x05, 0x00, 0x80, 0x08,
+    0x02, 0x40, 0x30, 0x06, 0x00, 0x90, 0x00, 0x0A, 0x80, 0xA1, 0x83, 0x02, 0x08, 0x89, 0x22, 0x64,
+    0xC0, 0x92, 0x43, 0x02, 0xB4, 0x00, 0x00, 0x19, 0x02, 0xD0, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
+    0x09, 0x0A, 0xF9, 0x1A, 0x80, 0x82, 0x80, 0x02, 0x00, 0x18, 0x00, 0x80, 0x09, 0x01, 0x90, 0x0F,
+    0xFD, 0x1A, 0x80, 0x91, 0x80, 0x03, 0x01, 0x64, 0x05, 0x90, 0x00, 0xC1, 0x03, 0x0A, 0xB4, 0x00,
+    0x00, 0x00, 0x90, 0x0B, 0x40, 0x69, 0x06, 0x24, 0x20, 0x91, 0xAB, 0xD0, 0x09, 0x00, 0x24, 0x1A,
+    0xA0, 0xA5, 0x02, 0x40, 0x0A, 0xA4, 0x00, 0x70, 0x00, 0x91, 0x03, 0x0A, 0xB4, 0x00, 0x00, 0x06,
+    0x90, 0x60, 0x42, 0x00, 0x0D, 0xA4, 0x38, 0x70, 0xC0, 0x92, 0x42, 0x42, 0xA8, 0x00, 0x00, 0x2A,
+    0xA4, 0x55, 0x80, 0x09, 0x00, 0x60, 0x02, 0x40, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x0A, 0x90, 0x91,
+    0xC2, 0x43, 0x06, 0x54, 0x19, 0xA0, 0x80, 0x93, 0x02, 0x46, 0xA8, 0x00, 0x00, 0x0A, 0x80, 0xD1,
+    0x86, 0x02, 0x0C, 0x0D, 0x1A, 0xA4, 0x00, 0xC0, 0x06, 0x0A, 0xA0, 0x00, 0x00, 0x01, 0xD2, 0x40,
+    0x00, 0xD7, 0x40, 0x01, 0xD2, 0x40, 0x00, 0x93, 0x86, 0x25, 0x00, 0x00, 0x00, 0x60, 0xA1, 0x90,
+    0x64, 0x02, 0x40, 0x18, 0x00, 0xAA, 0x80, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x28, 0x01, 0x90, 0x09,
+    0x02, 0x46, 0x4A, 0x00, 0x00, 0x04, 0x1A, 0xD0, 0x18, 0x09, 0x06, 0x03, 0x00, 0x00, 0x60, 0x1D,
+    0x00, 0x00, 0x06, 0x90, 0x60, 0x82, 0x01, 0x58, 0x1A, 0x52, 0x59, 0x58, 0x66, 0x29, 0x48, 0x00,
+    0x18, 0x10, 0x1A, 0x40, 0x03, 0x40, 0x1A, 0x00, 0x8C, 0x02, 0x24, 0x19, 0x60, 0xAA, 0xC3, 0x02,
+    0x58, 0x06, 0xAA, 0x49, 0x1C, 0x90, 0xCA, 0xA4, 0x95, 0x89, 0x06, 0x90, 0x9B, 0xB8, 0x00, 0x00,
+    0x2F, 0x82, 0x81, 0x0C, 0x00, 0x70, 0x01, 0xC0, 0x03, 0x00, 0x0A, 0x01, 0x0B, 0xB4, 0x00, 0x00,
+    0xEA, 0x0C, 0x1C, 0xC0, 0x9C, 0x06, 0xC0, 0x6C, 0x09, 0xC1, 0xCE, 0xE4, 0xBA, 0x99, 0x00, 0x90,
+    0x0A, 0xA4, 0xA5, 0x49, 0x00, 0x90, 0x0B, 0xFD, 0x7A, 0x96, 0x00, 0x60, 0x06, 0x54, 0x6A, 0x46,
+    0x00, 0x60, 0x06, 0x00, 0x00, 0x00, 0x2F, 0x82, 0x81, 0x0C, 0x00, 0x60, 0x01, 0x82, 0xD7, 0x02,
+    0x49, 0x09, 0x0A, 0xA0, 0x00, 0x00, 0x30, 0x24, 0xC0, 0x93, 0x02, 0x4E, 0xAD, 0x35, 0x64, 0xC0,
+    0x93, 0x02, 0x4C, 0x09, 0xAE, 0x80, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x0B, 0xFC,
+    0x1A, 0xA0, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x10, 0x61, 0xED, 0x00, 0x00, 0x80, 0x99,
+    0x28, 0x96, 0x09, 0xD0, 0xB7, 0x09, 0x28, 0x90, 0xC9, 0x06, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+    0x60, 0x06, 0x00, 0x60, 0x07, 0xFD, 0x34, 0x34, 0xE1, 0xD2, 0x8A, 0x4A, 0x69, 0x22, 0x64, 0x88,
+    0x92, 0x02, 0x48, 0x09, 0x34, 0x24, 0xE0, 0x93, 0x92, 0x4C, 0x89, 0x32, 0x64, 0xC2, 0x93, 0x0B,
+    0x4C, 0x0D, 0x00, 0x00, 0x2F, 0x43, 0x47, 0x18, 0x09, 0x60, 0x19, 0x80, 0x66, 0x02, 0x4D, 0x0C,
+    0x1E, 0xD0, 0x00, 0x00, 0xAA, 0x49, 0x09, 0x90, 0x69, 0x09, 0xBA, 0x49, 0x00, 0x90, 0x09, 0x00,
+    0x00, 0x00, 0x2F, 0x43, 0x47, 0x18, 0x09, 0x60, 0x19, 0x80, 0x66, 0x02, 0x4D, 0x0C, 0x1E, 0xD0,
+    0x09, 0x00, 0x0B, 0x40, 0xAA, 0x49, 0x09, 0x90, 0x99, 0x1C, 0xAB, 0x49, 0x34, 0x91, 0x89, 0x09,
+    0x00, 0x00, 0x2F, 0x82, 0x41, 0x09, 0x00, 0x1E, 0x40, 0x06, 0x80, 0x02, 0x44, 0x09, 0x2E, 0xE0,
+    0x00, 0x00, 0x6B, 0xA8, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+    0x30, 0x24, 0xC0, 0x93, 0x02, 0x4C, 0x09, 0x30, 0x24, 0xC0, 0x92, 0x43, 0x07, 0xB4, 0x00, 0x00,
+    0x60, 0x14, 0xC0, 0x92, 0x43, 0x06, 0x18, 0x0C, 0x90, 0x27, 0x00, 0x68, 0x00, 0xD0, 0x80, 0x08,
+    0x90, 0x0C, 0x92, 0x08, 0x63, 0x58, 0x65, 0x94, 0x28, 0xA4, 0x28, 0xA0, 0x28, 0x70, 0x20, 0x20,
+    0x61, 0x80, 0x9C, 0x01, 0xD0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x09, 0x60, 0x14, 0x90, 0xC1,
+    0x86, 0x02, 0x70, 0x07, 0x40, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x2A, 0xB4, 0x01, 0x80, 0x09, 0x00,
+    0x90, 0x06, 0x00, 0x30, 0x02, 0x40, 0x1F, 0xFD, 0x2A, 0x18, 0x05, 0x01, 0x40, 0x50, 0x14, 0x05,
+    0x01, 0x40, 0x50, 0x14, 0x06, 0xA0, 0x40, 0x05, 0x00, 0x20, 0x02, 0x40, 0x18, 0x00, 0xC0, 0x09,
+    0x00, 0x20, 0x02, 0x00, 0x14, 0x00, 0x80, 0x69, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x69, 0x00, 0x03, 0x41, 0x60, 0x88, 0x61, 0x54, 0x10, 0x15, 0x51, 0xAA, 0x90, 0x50, 0x80,
+    0x00, 0x1A, 0xD0, 0x40, 0xC0, 0x5B, 0x4A, 0x49, 0x30, 0x34, 0xAA, 0x90, 0x00, 0x00, 0x40, 0x0C,
+    0x00, 0xC0, 0x0D, 0xB4, 0xD0, 0xDC, 0x09, 0xC0, 0x9D, 0x0D, 0xEB, 0x40, 0x00, 0x0B, 0xA0, 0xA0,
+    0x43, 0x00, 0x0C, 0x00, 0x24, 0x00, 0x2A, 0x90, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC0, 0x03, 0x06,
+    0xEC, 0x34, 0x31, 0x80, 0xC6, 0x03, 0x0C, 0x0C, 0x1E, 0xB0, 0x00, 0x00, 0x0A, 0x90, 0x90, 0x93,
+    0x56, 0x4D, 0x54, 0x34, 0x00, 0x2A, 0x80, 0x00, 0x00, 0x02, 0x90, 0xD1, 0x0C, 0x0A, 0xE9, 0x0C,
+    0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x0A, 0xA8, 0x91, 0x82, 0x46, 0x07, 0xA4, 0x20, 0x00,
+    0x7A, 0x92, 0x01, 0x8D, 0x09, 0x1A, 0x90, 0x40, 0x0C, 0x00, 0xC0, 0x0D, 0xB8, 0xE0, 0xDC, 0x09,
+    0xC0, 0x9C, 0x09, 0xC0, 0x90, 0x05, 0x06, 0x00, 0xAA, 0x06, 0x06, 0x06, 0x06, 0x06, 0x01, 0x40,
+    0x60, 0x00, 0xAA, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x61, 0x64, 0x64, 0x40, 0x09, 0x00,
+    0x90, 0x09, 0x08, 0x92, 0x49, 0xD0, 0xB7, 0x09, 0x18, 0x90, 0xA0, 0x2A, 0x00, 0x5C, 0x00, 0x30,
+    0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x02, 0xA4, 0x00, 0x00, 0x6A, 0xB5, 0x89,
+    0x66, 0x21, 0x98, 0x86, 0x62, 0x19, 0x88, 0x60, 0x9B, 0x8E, 0x0D, 0xC0, 0x9C, 0x09, 0xC0, 0x9C,
+    0x09, 0x0A, 0x90, 0xD0, 0xC6, 0x02, 0x58, 0x09, 0x30, 0x34, 0x7B, 0x40, 0x00, 0x00, 0x9B, 0x4D,
+    0x0D, 0xC0, 0x9C, 0x09, 0xD0, 0xDE, 0xB4, 0xC0, 0x0C, 0x00, 0x40, 0x00, 0x1B, 0xA0, 0xD0, 0xC6,
+    0x03, 0x18, 0x0C, 0x30, 0x30, 0x7A, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x10, 0x56, 0xD7, 0x80, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x1A, 0x90, 0x90, 0x41, 0x94, 0x00, 0x68, 0x10, 0x24, 0xAA, 0x80,
+    0x00, 0x00, 0x01, 0x00, 0x14, 0x02, 0xFA, 0x42, 0x40, 0x09, 0x00, 0x24, 0x00, 0x60, 0x00, 0xE9,
+    0x00, 0x00, 0x20, 0x20, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0xBA, 0x80, 0x00, 0x00, 0x60,
+    0x14, 0x80, 0xC1, 0x86, 0x03, 0x24, 0x09, 0x80, 0x0D, 0x00, 0x81, 0x08, 0x93, 0x48, 0x66, 0x98,
+    0x24, 0xA4, 0x38, 0xA0, 0x28, 0x70, 0x24, 0x20, 0x32, 0x40, 0x78, 0x01, 0xE0, 0x18, 0x90, 0x90,
+    0xC0, 0x60, 0x14, 0x90, 0x81, 0x86, 0x02, 0x24, 0x06, 0x80, 0x0D, 0x00, 0x30, 0x06, 0x40, 0x14,
+    0x00, 0x2A, 0xA4, 0x02, 0x80, 0x28, 0x01, 0x80, 0x18, 0x00, 0xFA, 0x90, 0x01, 0x80, 0x90, 0x0C,
+    0x00, 0x80, 0x08, 0x06, 0x40, 0x08, 0x00, 0x80, 0x08, 0x00, 0xC0, 0x06, 0x80, 0xCC, 0xCC, 0xCC,
+    0xCC, 0xCC, 0xCC, 0x54, 0x02, 0x00, 0x80, 0x20, 0x08, 0x01, 0xE0, 0x90, 0x20, 0x08, 0x02, 0x06,
+    0x40, 0x19, 0x10, 0x86, 0x80,
+};
+
+static const SSD1963_Glyph mono12_glyphs[] = {
+    // offset, w, h, x_off, y_off, advance
+    {      0,   0,   0,    0,    0,   7 },  // ' '
+    {      0,   3,  10,    2,   -9,   7 },  // '!'
+    {      8,   5,   5,    1,   -9,   7 },  // '"'
+    {     15,   6,   8,    1,   -8,   7 },  // '#'
+    {     27,   6,  11,    1,   -9,   7 },  // '$'
+    {     44,   7,   9,    0,   -8,   7 },  // '%'
+    {     60,   7,  10,    0,   -9,   7 },  // '&'
+    {     78,   3,   5,    2,   -9,   7 },  // '''
+    {     82,   4,  12,    2,   -9,   7 },  // '('
+    {     94,   4,  12,    1,   -9,   7 },  // ')'
+    {    106,   6,   6,    1,   -7,   7 },  // '*'
+    {    115,   6,   6,    1,   -7,   7 },  // '+'
+    {    124,   3,   5,    2,   -2,   7 },  // ','
+    {    128,   6,   2,    1,   -5,   7 },  // '-'
+    {    131,   3,   3,    2,   -2,   7 },  // '.'
+    {    134,   6,  11,    1,   -9,   7 },  // '/'
+    {    151,   7,   9,    0,   -8,   7 },  // '0'
+    {    167,   6,   8,    1,   -8,   7 },  // '1'
+    {    179,   7,   8,    0,   -8,   7 },  // '2'
+    {    193,   7,   9,    0,   -8,   7 },  // '3'
+    {    209,   7,   8,    0,   -8,   7 },  // '4'
+    {    223,   7,   9,    0,   -8,   7 },  // '5'
+    {    239,   7,   9,    0,   -8,   7 },  // '6'
+    {    255,   7,   8,    0,   -8,   7 },  // '7'
+    {    269,   7,   9,    0,   -8,   7 },  // '8'
+    {    285,   7,   9,    0,   -8,   7 },  // '9'
+    {    301,   3,   8,    2,   -7,   7 },  // ':'
+    {    307,   3,  10,    2,   -7,   7 },  // ';'
+    {    315,   5,   8,    1,   -8,   7 },  // '<'
+    {    325,   6,   4,    1,   -6,   7 },  // '='
+    {    331,   5,   8,    1,   -8,   7 },  // '>'
+    {    341,   5,  10,    1,   -9,   7 },  // '?'
+    {    354,   7,  10,    0,   -8,   7 },  // '@'
+    {    372,   7,   8,    0,   -8,   7 },  // 'A'
+    {    386,   6,   8,    1,   -8,   7 },  // 'B'
+    {    398,   7,  10,    0,   -9,   7 },  // 'C'
+    {    416,   6,   8,    1,   -8,   7 },  // 'D'
+    {    428,   6,   8,    1,   -8,   7 },  // 'E'
+    {    440,   6,   8,    1,   -8,   7 },  // 'F'
+    {    452,   7,  10,    0,   -9,   7 },  // 'G'
+    {    470,   7,   8,    0,   -8,   7 },  // 'H'
+    {    484,   6,   8,    1,   -8,   7 },  // 'I'
+    {    496,   6,   9,    0,   -8,   7 },  // 'J'
+    {    510,   6,   8,    1,   -8,   7 },  // 'K'
+    {    522,   6,   8,    1,   -8,   7 },  // 'L'
+    {    534,   7,   8,    0,   -8,   7 },  // 'M'
+    {    548,   7,   8,    0,   -8,   7 },  // 'N'
+    {    562,   7,  10,    0,   -9,   7 },  // 'O'
+    {    580,   6,   8,    1,   -8,   7 },  // 'P'
+    {    592,   7,  11,    0,   -9,   7 },  // 'Q'
+    {    612,   6,   8,    1,   -8,   7 },  // 'R'
+    {    624,   7,  10,    0,   -9,   7 },  // 'S'
+    {    642,   7,   8,    0,   -8,   7 },  // 'T'
+    {    656,   7,   9,    0,   -8,   7 },  // 'U'
+    {    672,   7,   8,    0,   -8,   7 },  // 'V'
+    {    686,   8,   8,    0,   -8,   7 },  // 'W'
+    {    702,   7,   8,    0,   -8,   7 },  // 'X'
+    {    716,   7,   8,    0,   -8,   7 },  // 'Y'
+    {    730,   7,   8,    0,   -8,   7 },  // 'Z'
+    {    744,   5,  11,    2,   -9,   7 },  // '['
+    {    758,   6,  11,    1,   -9,   7 },  // '\\'
+    {    775,   4,  11,    1,   -9,   7 },  // ']'
+    {    786,   5,   6,    1,   -9,   7 },  // '^'
+    {    794,   7,   2,    0,    0,   7 },  // '_'
+    {    798,   3,   3,    2,   -9,   7 },  // '`'
+    {    801,   7,   7,    0,   -6,   7 },  // 'a'
+    {    814,   6,  10,    1,   -9,   7 },  // 'b'
+    {    829,   7,   7,    0,   -6,   7 },  // 'c'
+    {    842,   7,  10,    0,   -9,   7 },  // 'd'
+    {    860,   7,   7,    0,   -6,   7 },  // 'e'
+    {    873,   6,   9,    1,   -9,   7 },  // 'f'
+    {    887,   7,   9,    0,   -6,   7 },  // 'g'
+    {    903,   6,   9,    1,   -9,   7 },  // 'h'
+    {    917,   4,   9,    1,   -9,   7 },  // 'i'
+    {    926,   5,  12,    0,   -9,   7 },  // 'j'
+    {    941,   6,   9,    1,   -9,   7 },  // 'k'
+    {    955,   7,  10,    0,   -9,   7 },  // 'l'
+    {    973,   7,   6,    0,   -6,   7 },  // 'm'
+    {    984,   6,   6,    1,   -6,   7 },  // 'n'
+    {    993,   7,   7,    0,   -6,   7 },  // 'o'
+    {   1006,   6,   9,    1,   -6,   7 },  // 'p'
+    {   1020,   7,   9,    0,   -6,   7 },  // 'q'
+    {   1036,   6,   6,    1,   -6,   7 },  // 'r'
+    {   1045,   7,   7,    0,   -6,   7 },  // 's'
+    {   1058,   7,   9,    0,   -8,   7 },  // 't'
+    {   1074,   7,   7,    0,   -6,   7 },  // 'u'
+    {   1087,   7,   6,    0,   -6,   7 },  // 'v'
+    {   1098,   8,   6,    0,   -6,   7 },  // 'w'
+    {   1110,   7,   6,    0,   -6,   7 },  // 'x'
+    {   1121,   7,   9,    0,   -6,   7 },  // 'y'
+    {   1137,   7,   6,    0,   -6,   7 },  // 'z'
+    {   1148,   6,  11,    1,   -9,   7 },  // '{'
+    {   1165,   2,  12,    3,   -9,   7 },  // '|'
+    {   1171,   5,  11,    1,   -9,   7 },  // '}'
+    {   1185,   7,   2,    0,   -5,   7 },  // '~'
+};
+
+const SSD1963_Font font_mono12 = {
+    mono12_bitmap,
+    mono12_glyphs,
+    32, 126,  // first, last
+    2,  // bpp
+    16, 12  // line height, ascent
+};
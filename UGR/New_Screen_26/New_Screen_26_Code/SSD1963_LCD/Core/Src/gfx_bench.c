@@ -0,0 +1,615 @@
+#include "gfx_bench.h"
+#include "perf.h"
+#include "ssd1963.h"
+#include "ssd1963_bus.h"
+#include "ssd1963_gfx.h"
+#include "ssd1963_font.h"
+#include "ssd1963_shapes.h"
+#include "tile_render.h"
+#include "blit2d.h"
+#include "blend565.h"
+#include "fonts.h"
+#include "ssd1963_image.h"
+#include "images.h"
+#include "ui_dirty.h"
+#include "ui_vsync.h"
+#include "ui_chart.h"
+#include "ssd1963_capture.h"
+#include "can_signal.h"
+#include "main.h"
+
+#include <stdio.h>
+#include <stddef.h>
+
+typedef struct
+{
+    const char* group;
+    const char* name;
+    void (*run)(void);
+} GFXBENCH_Case;
+
+// -----------------------------
+// Reference dashboard layout
+// -----------------------------
+#define BENCH_BG    RGB565(16, 16, 24)
+#define BENCH_BOX   RGB565(40, 40, 56)
+#define BENCH_BAR   RGB565(255, 64, 0)
+
+static const SSD1963_Rect bench_rpm   = { 40, 40, 759, 119 };
+static const SSD1963_Rect bench_gear  = { 340, 180, 459, 339 };
+static const SSD1963_Rect bench_vals[3] = {
+    { 40, 380, 239, 439 }, { 300, 380, 499, 439 }, { 560, 380, 759, 439 }
+};
+
+static uint16_t bench_rpm_fill = 360;
+static uint16_t bench_icon[32 * 32];
+
+static void bench_box(const SSD1963_Rect* r, uint16_t c)
+{
+    SSD1963_FillRect(r->x0, r->y0, (int16_t)(r->x1 - r->x0 + 1), (int16_t)(r->y1 - r->y0 + 1), c);
+}
+
+static void bench_redraw(const SSD1963_Rect* area)
+{
+    (void)area;
+
+    bench_box(&(SSD1963_Rect){ 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 }, BENCH_BG);
+    bench_box(&bench_rpm, BENCH_BOX);
+    SSD1963_FillRect(bench_rpm.x0, bench_rpm.y0, (int16_t)bench_rpm_fill,
+                     (int16_t)(bench_rpm.y1 - bench_rpm.y0 + 1), BENCH_BAR);
+    bench_box(&bench_gear, BENCH_BOX);
+    SSD1963_Blit(384, 244, 32, 32, bench_icon);
+    for (uint32_t i = 0; i < 3; i++) bench_box(&bench_vals[i], BENCH_BOX);
+}
+
+// -----------------------------
+// Cases
+// -----------------------------
+static void case_window(void)      { SSD1963_SetWindow(0, 0, 99, 99); }
+static void case_pixel(void)       { SSD1963_DrawPixel(10, 10, 0xFFFF); }
+static void case_hline(void)       { SSD1963_DrawHLine(100, 100, 200, 0xFFFF); }
+static void case_vline(void)       { SSD1963_DrawVLine(100, 100, 200, 0xFFFF); }
+static void case_rect(void)        { SSD1963_FillRect(100, 100, 100, 100, 0xF800); }
+static void case_rect_clip(void)   { SSD1963_FillRect(750, 430, 100, 100, 0x07E0); }
+static void case_fill_cpu(void)    { SSD1963_Fill(0x001F); }
+static void case_fill_dma(void)    { SSD1963_FillAsync(0x001F, NULL); SSD1963_WaitIdle(); }
+static void case_blit(void)        { SSD1963_Blit(200, 200, 32, 32, bench_icon); }
+static void case_scanline(void)    { (void)SSD1963_GetScanline(); }
+
+// The pixel loops as they were before lcd_dat_fill / lcd_dat_copy: one 16-bit store each
+static void case_fill_halfword(void)
+{
+    SSD1963_SetWindow(0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1);
+    const uint32_t pixels = (uint32_t)SSD_HOR_RESOLUTION * (uint32_t)SSD_VER_RESOLUTION;
+    for (uint32_t i = 0; i < pixels; i++) lcd_dat(0x001F);
+}
+
+// -----------------------------
+// CPU-bound loops: no bus traffic, so these show what the caches and clock buy
+// -----------------------------
+#define BENCH_STRIP_ROWS    16
+#define BENCH_CAN_FRAMES    256
+
+static uint16_t bench_strip[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS];
+static CANRX_Frame bench_frames[BENCH_CAN_FRAMES];
+static volatile int32_t bench_sink;
+
+// Software-render one 16-row strip of the dashboard into SRAM
+static void case_cpu_render(void)
+{
+    const uint32_t bar_end = (40u + bench_rpm_fill < SSD_HOR_RESOLUTION) ? 40u + bench_rpm_fill : SSD_HOR_RESOLUTION;
+
+    for (uint32_t y = 0; y < BENCH_STRIP_ROWS; y++)
+    {
+        uint16_t* row = &bench_strip[y * SSD_HOR_RESOLUTION];
+        for (uint32_t x = 0; x < SSD_HOR_RESOLUTION; x++) row[x] = RGB565(x >> 2, y * 16, 255 - (x >> 2));
+        for (uint32_t x = 40; x < bar_end; x++) row[x] = BENCH_BAR;
+        for (uint32_t x = 0; x < 32; x++) row[384 + x] = bench_icon[(y * 2) * 32 + x];
+    }
+    bench_sink = bench_strip[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS - 1];
+}
+
+// Decode a batch of ECU frames, every message of the DBC in turn, into the signal store
+static void case_cpu_can(void)
+{
+    CANSIG_Decode(bench_frames, BENCH_CAN_FRAMES);
+    bench_sink = (int32_t)cansig_store.value[0];
+}
+
+// -----------------------------
+// Text
+// -----------------------------
+static const char bench_label[] = "OIL TEMP 104 C";
+
+static void case_text_cold(void)
+{
+    SSD1963_FontCacheFlush();
+    SSD1963_DrawText(40, 140, &font_lato16, bench_label, 0xFFFF, BENCH_BG);
+}
+
+static void case_text_cached(void)
+{
+    SSD1963_DrawText(40, 140, &font_lato16, bench_label, 0xFFFF, BENCH_BG);
+}
+
+static void case_text_mono(void)
+{
+    SSD1963_DrawText(40, 170, &font_mono12, "WATER 92.5  OIL 4.1 bar", 0xFFFF, BENCH_BG);
+}
+
+static void case_text_lap(void)
+{
+    SSD1963_DrawText(300, 200, &font_digits48, "1:23.456", 0xFFFF, BENCH_BOX);
+}
+
+// The same label plotted one covered pixel at a time, for scale
+static void case_text_pixels(void)
+{
+    const SSD1963_Font* f = &font_lato16;
+    int16_t pen = 40;
+
+    for (const char* c = bench_label; *c; c++)
+    {
+        const SSD1963_Glyph* g = &f->glyphs[(uint8_t)*c - f->first];
+        const uint8_t max = (uint8_t)((1u << f->bpp) - 1u);
+        for (uint32_t i = 0; i < (uint32_t)g->width * g->height; i++)
+        {
+            const uint32_t bit = i * f->bpp;
+            const uint8_t a = (uint8_t)((f->bitmap[g->offset + (bit >> 3)] >> (8u - f->bpp - (bit & 7u))) & max);
+            if (a > max / 2u)
+                SSD1963_DrawPixel((int16_t)(pen + g->x_off + (int16_t)(i % g->width)),
+                                  (int16_t)(140 + f->ascent + g->y_off + (int16_t)(i / g->width)), 0xFFFF);
+        }
+        pen = (int16_t)(pen + g->advance);
+    }
+}
+
+// -----------------------------
+// Gauge shapes
+// -----------------------------
+#define BENCH_GAUGE_X       200
+#define BENCH_GAUGE_Y       240
+#define BENCH_GAUGE_R       150
+#define BENCH_GAUGE_T       16
+#define BENCH_GAUGE_START   SSD1963_DEG(135)
+
+static int32_t bench_needle = SSD1963_DEG(40);
+
+static void bench_needle_draw(int32_t angle, uint16_t c)
+{
+    const int32_t a = BENCH_GAUGE_START + angle;
+    const int16_t len = BENCH_GAUGE_R - BENCH_GAUGE_T - 8;
+    SSD1963_DrawThickLine(BENCH_GAUGE_X, BENCH_GAUGE_Y,
+                          (int16_t)(BENCH_GAUGE_X + ((SSD1963_Cos(a) * len) >> 15)),
+                          (int16_t)(BENCH_GAUGE_Y + ((SSD1963_Sin(a) * len) >> 15)), 5, c);
+}
+
+static void case_line_shallow(void) { SSD1963_DrawLine(100, 100, 500, 300, 0xFFFF); }
+static void case_line_steep(void)   { SSD1963_DrawLine(100, 50, 300, 450, 0xFFFF); }
+static void case_circle(void)       { SSD1963_DrawCircle(400, 240, 100, 0xFFFF); }
+static void case_disc(void)         { SSD1963_FillCircle(400, 240, 60, 0xFFFF); }
+
+static void case_gauge_full(void)
+{
+    SSD1963_DrawArc(BENCH_GAUGE_X, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_T,
+                    BENCH_GAUGE_START, SSD1963_DEG(270), BENCH_BOX);
+    SSD1963_DrawArc(BENCH_GAUGE_X, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_T,
+                    BENCH_GAUGE_START, bench_needle, BENCH_BAR);
+    bench_needle_draw(bench_needle, 0xFFFF);
+    SSD1963_FillCircle(BENCH_GAUGE_X, BENCH_GAUGE_Y, 10, 0xFFFF);
+}
+
+// Value moves by 10 degrees: extend the arc, move the needle, restore the hub
+static void case_gauge_sweep(void)
+{
+    const int32_t next = bench_needle + SSD1963_DEG(10);
+
+    SSD1963_DrawArc(BENCH_GAUGE_X, BENCH_GAUGE_Y, BENCH_GAUGE_R, BENCH_GAUGE_T,
+                    BENCH_GAUGE_START + bench_needle, next - bench_needle, BENCH_BAR);
+    bench_needle_draw(bench_needle, BENCH_BG);
+    bench_needle_draw(next, 0xFFFF);
+    SSD1963_FillCircle(BENCH_GAUGE_X, BENCH_GAUGE_Y, 10, 0xFFFF);
+    bench_needle = next;
+}
+
+// The gauge ring plotted one pixel at a time, for scale
+static void case_ring_pixels(void)
+{
+    const int32_t ro = BENCH_GAUGE_R, ri = BENCH_GAUGE_R - BENCH_GAUGE_T;
+
+    for (int32_t y = -ro; y <= ro; y++)
+        for (int32_t x = -ro; x <= ro; x++)
+        {
+            const int32_t d = x * x + y * y;
+            if (d <= ro * ro + ro && d > ri * ri + ri)
+                SSD1963_DrawPixel((int16_t)(BENCH_GAUGE_X + x), (int16_t)(BENCH_GAUGE_Y + y), BENCH_BOX);
+        }
+}
+
+// -----------------------------
+// Composited scene (strip renderer)
+// -----------------------------
+static void bench_scene(const TILE_Target* t)
+{
+    static const SSD1963_Rect screen = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+    static const SSD1963_Rect banner = { 0, 150, SSD_HOR_RESOLUTION - 1, 209 };
+
+    TILE_FillGradient(t, &screen, RGB565(40, 40, 64), RGB565(8, 8, 12));
+    TILE_Fill(t, &bench_rpm, BENCH_BOX);
+    TILE_Fill(t, &(SSD1963_Rect){ bench_rpm.x0, bench_rpm.y0, (int16_t)(bench_rpm.x0 + bench_rpm_fill - 1), bench_rpm.y1 },
+              BENCH_BAR);
+    for (uint32_t i = 0; i < 3; i++) TILE_FillAlpha(t, &bench_vals[i], 0xFFFF, 40);
+    TILE_Blit(t, 384, 244, 32, 32, bench_icon);
+
+    // Translucent warning banner over the bar and the gradient, text on top of both
+    TILE_FillAlpha(t, &banner, RGB565(255, 0, 0), 140);
+    TILE_DrawText(t, 300, 170, &font_lato16, "OIL PRESSURE LOW", 0xFFFF);
+    TILE_DrawText(t, 60, 390, &font_digits48, "1:23.456", 0xFFFF);
+}
+
+static void case_tile_scene(void)    { TILE_Render(&(SSD1963_Rect){ 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 }, bench_scene); }
+static void case_tile_value(void)    { TILE_Render(&bench_vals[0], bench_scene); }
+
+// -----------------------------
+// Pixel operations: the selected blit2d backend against the CPU loops, into a strip in
+// cacheable SRAM so the DMA2D cases pay for their cache maintenance
+// -----------------------------
+#define BENCH_OVERLAY_W     128
+#define BENCH_PALETTE       16
+
+static uint16_t bench_copy_src[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS];
+static uint32_t bench_argb8888[BENCH_OVERLAY_W * BENCH_STRIP_ROWS];
+static uint16_t bench_argb4444[BENCH_OVERLAY_W * BENCH_STRIP_ROWS];
+static uint8_t bench_l8[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS];
+static uint32_t bench_clut[BENCH_PALETTE];
+
+#define BENCH_W     SSD_HOR_RESOLUTION
+#define BENCH_H     BENCH_STRIP_ROWS
+
+static void case_blit_fill_cpu(void)   { BLIT_CpuFill(bench_strip, BENCH_W, BENCH_W, BENCH_H, BENCH_BOX); }
+static void case_blit_fill(void)       { BLIT_Fill(bench_strip, BENCH_W, BENCH_W, BENCH_H, BENCH_BOX); BLIT_Wait(); }
+static void case_blit_strip_halfword(void)
+{
+    SSD1963_SetWindow(0, 0, BENCH_W - 1, BENCH_H - 1);
+    for (uint32_t i = 0; i < BENCH_W * BENCH_H; i++) lcd_dat(bench_copy_src[i]);
+}
+
+static void case_blit_strip(void)       { SSD1963_Blit(0, 0, BENCH_W, BENCH_H, bench_copy_src); }
+static void case_blit_copy_cpu(void)   { BLIT_CpuCopy(bench_strip, BENCH_W, bench_copy_src, BENCH_W, BENCH_W, BENCH_H); }
+static void case_blit_copy(void)       { BLIT_Copy(bench_strip, BENCH_W, bench_copy_src, BENCH_W, BENCH_W, BENCH_H); BLIT_Wait(); }
+
+static void case_blit_8888_cpu(void)
+{
+    BLIT_CpuBlendArgb8888(bench_strip + 336, BENCH_W, bench_argb8888, BENCH_OVERLAY_W, BENCH_OVERLAY_W, BENCH_H);
+}
+
+static void case_blit_8888(void)
+{
+    BLIT_BlendArgb8888(bench_strip + 336, BENCH_W, bench_argb8888, BENCH_OVERLAY_W, BENCH_OVERLAY_W, BENCH_H);
+    BLIT_Wait();
+}
+
+static void case_blit_4444_cpu(void)
+{
+    BLIT_CpuBlendArgb4444(bench_strip + 336, BENCH_W, bench_argb4444, BENCH_OVERLAY_W, BENCH_OVERLAY_W, BENCH_H);
+}
+
+static void case_blit_4444(void)
+{
+    BLIT_BlendArgb4444(bench_strip + 336, BENCH_W, bench_argb4444, BENCH_OVERLAY_W, BENCH_OVERLAY_W, BENCH_H);
+    BLIT_Wait();
+}
+
+static void case_blit_l8_cpu(void)
+{
+    BLIT_CpuExpandL8(bench_strip, BENCH_W, bench_l8, BENCH_W, BENCH_W, BENCH_H, bench_clut, BENCH_PALETTE);
+}
+
+static void case_blit_l8(void)
+{
+    BLIT_ExpandL8(bench_strip, BENCH_W, bench_l8, BENCH_W, BENCH_W, BENCH_H, bench_clut, BENCH_PALETTE);
+    BLIT_Wait();
+}
+
+// -----------------------------
+// Blending (blend565.h): scalar reference against the DSP loops, same strip and overlay
+// -----------------------------
+#define BENCH_ALPHA         160
+
+static uint8_t bench_a8[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS];
+static uint8_t bench_a4[SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS / 2];
+
+static void case_blend_colour_ref(void) { BLEND_RefColour(bench_strip, BENCH_BAR, BENCH_ALPHA, BENCH_W * BENCH_H); }
+static void case_blend_colour(void)     { BLEND_Colour(bench_strip, BENCH_BAR, BENCH_ALPHA, BENCH_W * BENCH_H); }
+static void case_blend_a8_ref(void)     { BLEND_RefImageA8(bench_strip, bench_copy_src, bench_a8, BENCH_W * BENCH_H); }
+static void case_blend_a8(void)         { BLEND_ImageA8(bench_strip, bench_copy_src, bench_a8, BENCH_W * BENCH_H); }
+static void case_blend_a4_ref(void)     { BLEND_RefImageA4(bench_strip, bench_copy_src, bench_a4, 0, BENCH_W * BENCH_H); }
+static void case_blend_a4(void)         { BLEND_ImageA4(bench_strip, bench_copy_src, bench_a4, 0, BENCH_W * BENCH_H); }
+
+// -----------------------------
+// Images
+// -----------------------------
+static void case_image_bg(void)     { SSD1963_DrawImage(0, 0, &img_dash_bg); }
+static void case_image_icon(void)   { SSD1963_DrawImage(376, 236, &img_warning); }
+
+// Background behind one value box only, as a dirty-rectangle redraw would do it
+static void case_image_bg_clip(void)
+{
+    SSD1963_SetClip(&bench_vals[1]);
+    SSD1963_DrawImage(0, 0, &img_dash_bg);
+    SSD1963_SetClip(NULL);
+}
+
+// -----------------------------
+// Strip chart: 600 columns of lanes over a 240-row history
+// -----------------------------
+static const UI_Chart bench_chart = {
+    .y0 = 240, .rows = 240,
+    .bg = BENCH_BG, .grid = BENCH_BOX, .grid_every = 50,
+    .traces = 3,
+    .trace = {
+        { 100, 299, 0, 1000, BENCH_BAR }, { 300, 499, 0, 1000, 0xFFFF }, { 500, 699, 0, 1000, 0x07E0 },
+    },
+};
+
+static int32_t bench_chart_t;
+
+static void case_chart_sample(void)
+{
+    bench_chart_t += 37;
+    const int32_t v[3] = { bench_chart_t % 1000, (bench_chart_t * 3) % 1000, 500 };
+    UI_ChartPush(v);
+}
+
+// What shifting the same chart in software costs: every row rewritten
+static void case_chart_repaint(void)
+{
+    for (int16_t y = 0; y < bench_chart.rows; y++)
+    {
+        SSD1963_Blit(100, (int16_t)(bench_chart.y0 + y), 600, 1, bench_copy_src);
+    }
+}
+
+static void case_layout_full(void)
+{
+    UI_InvalidateAll();
+    UI_Flush(bench_redraw);
+}
+
+static void case_layout_rpm(void)
+{
+    const uint16_t old = bench_rpm_fill;
+    bench_rpm_fill = (uint16_t)(bench_rpm_fill + 24);
+    const SSD1963_Rect r = { (int16_t)(bench_rpm.x0 + old), bench_rpm.y0,
+                             (int16_t)(bench_rpm.x0 + bench_rpm_fill - 1), bench_rpm.y1 };
+    UI_Invalidate(&r);
+    UI_Flush(bench_redraw);
+}
+
+static void case_layout_values(void)
+{
+    for (uint32_t i = 0; i < 3; i++) UI_Invalidate(&bench_vals[i]);
+    UI_Flush(bench_redraw);
+}
+
+static void case_layout_values_synced(void)
+{
+    for (uint32_t i = 0; i < 3; i++) UI_Invalidate(&bench_vals[i]);
+    UI_FlushSynced(bench_redraw);
+}
+
+// Capture cost without a storage device: the sink only takes the bytes
+static uint8_t bench_null_sink(void* ctx, const uint8_t* data, uint32_t len)
+{
+    (void)ctx;
+    (void)data;
+    (void)len;
+    return 1;
+}
+
+static void case_capture_box(void)
+{
+    const SSD1963_Rect r = { 100, 100, 199, 199 };
+    SSD1963_Capture(&r, SSD1963_CAPTURE_RGB565, bench_null_sink, NULL);
+}
+
+static void case_capture_full(void)
+{
+    const SSD1963_Rect r = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+    SSD1963_Capture(&r, SSD1963_CAPTURE_PPM, bench_null_sink, NULL);
+}
+
+static const GFXBENCH_Case bench_cases[] = {
+    { "primitive", "SetWindow",         case_window },
+    { "primitive", "DrawPixel",         case_pixel },
+    { "primitive", "HLine 200",         case_hline },
+    { "primitive", "VLine 200",         case_vline },
+    { "primitive", "FillRect 100x100",  case_rect },
+    { "primitive", "FillRect clipped",  case_rect_clip },
+    { "primitive", "Blit 32x32",        case_blit },
+    { "primitive", "Fill halfword",     case_fill_halfword },
+    { "primitive", "Fill (CPU)",        case_fill_cpu },
+    { "primitive", "Fill (DMA)",        case_fill_dma },
+    { "primitive", "Blit 800x16 halfword", case_blit_strip_halfword },
+    { "primitive", "Blit 800x16",       case_blit_strip },
+    { "primitive", "GetScanline",       case_scanline },
+    { "cpu",       "render strip 800x16", case_cpu_render },
+    { "cpu",       "can decode x256",   case_cpu_can },
+    { "text",      "16px 14 chars cold", case_text_cold },
+    { "text",      "16px 14 chars",     case_text_cached },
+    { "text",      "16px per-pixel",    case_text_pixels },
+    { "text",      "mono12 23 chars",   case_text_mono },
+    { "text",      "lap time 48px",     case_text_lap },
+    { "shape",     "line 400x200",      case_line_shallow },
+    { "shape",     "line 200x400",      case_line_steep },
+    { "shape",     "circle r100",       case_circle },
+    { "shape",     "disc r60",          case_disc },
+    { "shape",     "gauge full",        case_gauge_full },
+    { "shape",     "gauge sweep 10deg", case_gauge_sweep },
+    { "shape",     "ring per-pixel",    case_ring_pixels },
+    { "tile",      "scene 800x480",     case_tile_scene },
+    { "tile",      "scene value box",   case_tile_value },
+    { "blit",      "fill 800x16 cpu",   case_blit_fill_cpu },
+    { "blit",      "fill 800x16 " BLIT_BACKEND_NAME, case_blit_fill },
+    { "blit",      "copy 800x16 cpu",   case_blit_copy_cpu },
+    { "blit",      "copy 800x16 " BLIT_BACKEND_NAME, case_blit_copy },
+    { "blit",      "argb8888 128 cpu",  case_blit_8888_cpu },
+    { "blit",      "argb8888 128 " BLIT_BACKEND_NAME, case_blit_8888 },
+    { "blit",      "argb4444 128 cpu",  case_blit_4444_cpu },
+    { "blit",      "argb4444 128 " BLIT_BACKEND_NAME, case_blit_4444 },
+    { "blit",      "l8 800x16 cpu",     case_blit_l8_cpu },
+    { "blit",      "l8 800x16 " BLIT_BACKEND_NAME, case_blit_l8 },
+    { "blend",     "colour 800x16 ref", case_blend_colour_ref },
+    { "blend",     "colour 800x16",     case_blend_colour },
+    { "blend",     "a8 800x16 ref",     case_blend_a8_ref },
+    { "blend",     "a8 800x16",         case_blend_a8 },
+    { "blend",     "a4 800x16 ref",     case_blend_a4_ref },
+    { "blend",     "a4 800x16",         case_blend_a4 },
+    { "image",     "background 800x480", case_image_bg },
+    { "image",     "background clipped", case_image_bg_clip },
+    { "image",     "icon 48x48",        case_image_icon },
+    { "capture",   "capture 100x100",   case_capture_box },
+    { "capture",   "capture 800x480 ppm", case_capture_full },
+    { "layout",    "dash full redraw",  case_layout_full },
+    { "layout",    "dash rpm update",   case_layout_rpm },
+    { "layout",    "dash 3 values",     case_layout_values },
+    { "layout",    "dash 3 values sync", case_layout_values_synced },
+};
+
+// Run with the chart holding the scroll area, and only these: the other cases draw into
+// the band, and ui_vsync assumes frame-memory rows are the rows on the glass
+static const GFXBENCH_Case bench_chart_cases[] = {
+    { "chart",     "chart sample 600",  case_chart_sample },
+    { "chart",     "chart repaint 600",  case_chart_repaint },
+};
+
+static uint32_t bench_run_cases(const GFXBENCH_Case* cases, uint32_t count, const PERF_BusTiming* timing,
+                                GFXBENCH_Result* out, uint32_t max)
+{
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < count && n < max; i++)
+    {
+        SSD1963_WaitIdle();
+        PERF_ResetBus();
+
+        const uint32_t t0 = PERF_Cycles();
+        cases[i].run();
+        SSD1963_WaitIdle();
+        const uint32_t t1 = PERF_Cycles();
+
+        GFXBENCH_Result* r = &out[n++];
+        r->group = cases[i].group;
+        r->name = cases[i].name;
+        r->cmd_writes = perf_bus.cmd_writes;
+        r->data_writes = perf_bus.data_writes;
+        r->dma_beats = perf_bus.dma_beats;
+        r->data_reads = perf_bus.data_reads;
+        r->bus_us = PERF_BusTimeUs(&perf_bus, timing);
+        r->cycles = t1 - t0;
+    }
+    return n;
+}
+
+uint32_t GFXBENCH_Run(GFXBENCH_Result* out, uint32_t max)
+{
+    for (uint32_t y = 0; y < 32; y++)
+        for (uint32_t x = 0; x < 32; x++)
+            bench_icon[y * 32 + x] = RGB565(x * 8, y * 8, 128);
+
+    uint32_t seed = 0x1234567u;
+    for (uint32_t i = 0; i < BENCH_CAN_FRAMES; i++)
+    {
+        const CANSIG_Message* m = &cansig_messages[i % CANDB_MESSAGE_COUNT];
+        bench_frames[i].id = m->key & ~CANSIG_KEY_EXT;
+        bench_frames[i].flags = (m->key & CANSIG_KEY_EXT) ? CANRX_EXT : 0u;
+        bench_frames[i].dlc = m->dlc;
+        for (uint32_t b = 0; b < 8; b++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            bench_frames[i].data[b] = (uint8_t)(seed >> 24);
+        }
+    }
+
+    // Overlays fade left to right, so every alpha level is exercised
+    for (uint32_t y = 0; y < BENCH_STRIP_ROWS; y++)
+        for (uint32_t x = 0; x < BENCH_OVERLAY_W; x++)
+        {
+            bench_argb8888[y * BENCH_OVERLAY_W + x] = ((x * 2u) << 24) | 0x00FF4000u | (y * 16u);
+            bench_argb4444[y * BENCH_OVERLAY_W + x] = (uint16_t)(((x / 8u) << 12) | 0x0F40u | y);
+        }
+    for (uint32_t i = 0; i < SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS; i++)
+    {
+        bench_copy_src[i] = (uint16_t)(i * 37u);
+        bench_l8[i] = (uint8_t)((i / 50u) % BENCH_PALETTE);
+        bench_a8[i] = (uint8_t)i;
+    }
+    for (uint32_t i = 0; i < SSD_HOR_RESOLUTION * BENCH_STRIP_ROWS / 2; i++) bench_a4[i] = (uint8_t)(i * 7u);
+    for (uint32_t i = 0; i < BENCH_PALETTE; i++) bench_clut[i] = 0xFF000000u | (i * 0x00101010u);
+
+    PERF_BusTiming timing;
+    PERF_GetBusTiming(&timing);
+
+    uint32_t n = bench_run_cases(bench_cases, sizeof(bench_cases) / sizeof(bench_cases[0]), &timing, out, max);
+
+    // Last, so nothing runs on a panel the chart has left in scrolled order
+    UI_ChartStart(&bench_chart);
+    n += bench_run_cases(bench_chart_cases, sizeof(bench_chart_cases) / sizeof(bench_chart_cases[0]), &timing,
+                         &out[n], max - n);
+    UI_ChartStop();
+
+    return n;
+}
+
+void GFXBENCH_Print(const GFXBENCH_Result* results, uint32_t n)
+{
+    PERF_BusTiming t;
+    PERF_GetBusTiming(&t);
+
+    printf("Panel: " SSD1963_PANEL_NAME "\n");
+    printf("FMC: ADDSET=%u DATAST=%u BUSTURN=%u -> %lu HCLK/write, "
+           "DATAST=%u BUSTURN=%u -> %lu HCLK/read @ %lu Hz\n",
+           t.addset, t.datast, t.busturn, (unsigned long)PERF_BusWriteCycles(&t),
+           t.rd_datast, t.rd_busturn, (unsigned long)PERF_BusReadCycles(&t),
+           (unsigned long)t.hclk_hz);
+    printf("%-10s %-20s %8s %9s %9s %6s %10s %11s\n",
+           "group", "case", "cmd", "data", "dma", "reads", "bus us", "cpu cycles");
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const GFXBENCH_Result* r = &results[i];
+        printf("%-10s %-20s %8lu %9lu %9lu %6lu %10lu %11lu\n", r->group, r->name,
+               (unsigned long)r->cmd_writes, (unsigned long)r->data_writes,
+               (unsigned long)r->dma_beats, (unsigned long)r->data_reads,
+               (unsigned long)r->bus_us, (unsigned long)r->cycles);
+    }
+}
+
+#ifndef SSD1963_HOST_SIM
+void GFXBENCH_CacheCompare(void)
+{
+    static GFXBENCH_Result off[GFXBENCH_MAX_RESULTS];
+    static GFXBENCH_Result on[GFXBENCH_MAX_RESULTS];
+    const uint8_t icache = (SCB->CCR & SCB_CCR_IC_Msk) != 0;
+    const uint8_t dcache = (SCB->CCR & SCB_CCR_DC_Msk) != 0;
+
+    SCB_DisableDCache();
+    SCB_DisableICache();
+    const uint32_t n = GFXBENCH_Run(off, GFXBENCH_MAX_RESULTS);
+
+    SCB_EnableICache();
+    SCB_EnableDCache();
+    GFXBENCH_Run(on, n);
+
+    if (!dcache) SCB_DisableDCache();
+    if (!icache) SCB_DisableICache();
+
+    printf("%-10s %-20s %12s %12s %8s\n", "group", "case", "cache off", "cache on", "speedup");
+    for (uint32_t i = 0; i < n; i++)
+    {
+        const uint32_t x100 = on[i].cycles ? (uint32_t)(((uint64_t)off[i].cycles * 100u) / on[i].cycles) : 0u;
+        printf("%-10s %-20s %12lu %12lu %5lu.%02lu\n", off[i].group, off[i].name,
+               (unsigned long)off[i].cycles, (unsigned long)on[i].cycles,
+               (unsigned long)(x100 / 100u), (unsigned long)(x100 % 100u));
+    }
+}
+#endif
@@ -21,6 +21,7 @@
 #include "i2c.h"
 
 /* USER CODE BEGIN 0 */
+#include "clock_profile.h"
 
 /* USER CODE END 0 */
 
@@ -65,6 +66,8 @@ void MX_I2C1_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN I2C1_Init 2 */
+  // Timing above was generated for a 16 MHz PCLK1; recompute it for the running clock
+  CLK_ApplyI2cTiming(&hi2c1, CLK_I2C1_MODE);
 
   /* USER CODE END I2C1_Init 2 */
 
@@ -0,0 +1,581 @@
+// Generated by Host/Tools/imgconv.py from dash_bg.png, do not edit.
+//   imgconv.py dash_bg.png --name dash_bg
+// 800x480, 9143 bytes (raw RGB565 768000 bytes, 1.2%)
+#include "ssd1963_image.h"
+
+static const uint8_t dash_bg_data[] = {
+    0x86, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x86, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC1, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xFF, 0xE2, 0x05, 0x05, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC1, 0x86,
+    0x82, 0x10, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC1, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x83, 0x82, 0x10, 0xC4, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x41, 0xA3, 0x10, 0xA3, 0x10, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3,
+    0x18, 0xC5, 0x41, 0xC3, 0x18, 0xC3, 0x18, 0xFF, 0xE6, 0x05, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x41, 0xA3, 0x10, 0xA3, 0x10, 0xC5, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x08, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x86, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC1, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18,
+    0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xFF, 0xE2, 0x05, 0x05,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10,
+    0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC1, 0x86, 0x82, 0x10, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC1, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82,
+    0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10,
+    0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18,
+    0xA3, 0x10, 0x83, 0x82, 0x10, 0xC4, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3,
+    0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x41, 0xA3,
+    0x10, 0xA3, 0x10, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5,
+    0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x41, 0xC3, 0x18, 0xC3,
+    0x18, 0xFF, 0xE6, 0x05, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5,
+    0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x41, 0xA3, 0x10, 0xA3,
+    0x10, 0xC5, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4,
+    0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x08, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43,
+    0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18,
+    0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10,
+    0x87, 0x82, 0x10, 0x43, 0xA3, 0x10, 0xC3, 0x18, 0xC3, 0x18, 0xA3, 0x10, 0x87, 0x82, 0x10, 0x86,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC1, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xC5, 0x85,
+    0xC3, 0x18, 0xC5, 0x85, 0xC3, 0x18, 0xFF, 0xE2, 0x05, 0x05, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85, 0xA3, 0x10, 0xC5, 0x85,
+    0xA3, 0x10, 0xC1, 0x86, 0x82, 0x10, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06,
+    0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0xC4, 0x06, 0x40, 0xA3, 0x10, 0xBF, 0x80, 0x0C,
+    0x00, 0xFA, 0xBF, 0xA6, 0x25, 0xE5, 0x18, 0xBF, 0x94, 0x05, 0xCF, 0x5A, 0xFF, 0xAE, 0x06, 0xBF,
+    0x90, 0x05, 0x47, 0x29, 0xFF, 0xC8, 0x76, 0xA5, 0xC5, 0x18, 0xFF, 0x94, 0x05, 0xBF, 0x0C, 0xC5,
+    0x18, 0xFF, 0xA2, 0xF0, 0x02, 0x3F, 0x92, 0x05, 0xFF, 0xAC, 0x06, 0x3F, 0xE2, 0x05, 0x41, 0x72,
+    0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0,
+    0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72,
+    0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0,
+    0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72,
+    0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0,
+    0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72,
+    0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF,
+    0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72, 0x8C, 0x59,
+    0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x41, 0x72,
+    0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0,
+    0x41, 0x72, 0x8C, 0x59, 0xCE, 0xCF, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72, 0x8C, 0xD0, 0x40, 0x72,
+    0x8C, 0xFF, 0x81, 0x13, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59,
+    0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE,
+    0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0, 0x35, 0x40, 0x59, 0xCE, 0xD0,
+    0x35, 0x40, 0x59, 0xCE, 0xD0, 0x3F, 0x46, 0xFF, 0xF8, 0x11, 0xBF, 0xF2, 0xA7, 0x02, 0xC4, 0x18,
+    0xBF, 0x3C, 0xCF, 0x5A, 0xFF, 0xB2, 0x08, 0xBF, 0x92, 0x02, 0xA4, 0x10, 0xC1, 0xBF, 0x38, 0x47,
+    0x29, 0xC1, 0xBF, 0xE4, 0x04, 0xA4, 0x10, 0xFF, 0xCE, 0xE4, 0x05, 0xBF, 0x92, 0x02, 0x84, 0x10,
+    0xFF, 0x3C, 0xBF, 0xE4, 0x04, 0x84, 0x10, 0xFF, 0xEE, 0x15, 0xBF, 0x92, 0x02, 0x83, 0x10, 0xFF,
+    0x3C, 0xBF, 0xE4, 0x04, 0x83, 0x10, 0xFF, 0x82, 0xD4, 0x01, 0x3F, 0x3A, 0xFF, 0x84, 0x0B, 0x3F,
+    0x94, 0xDE, 0x01, 0xBF, 0x8C, 0x01, 0xCF, 0x5A, 0xF7, 0xBF, 0x8C, 0x01, 0xCF, 0x5A, 0xF7, 0xBF,
+    0x8C, 0x01, 0xCF, 0x5A, 0xFF, 0xAE, 0x06, 0xBF, 0x88, 0x01, 0x47, 0x29, 0xFB, 0xBF, 0x88, 0x01,
+    0x47, 0x29, 0xFB, 0xBF, 0x88, 0x01, 0x47, 0x29, 0xFF, 0xC8, 0xF3, 0x01, 0xA5, 0x63, 0x08, 0xFF,
+    0x8C, 0x01, 0xB7, 0x63, 0x08, 0xFF, 0x8C, 0x01, 0xB7, 0x63, 0x08, 0xFF, 0x8C, 0x01, 0xBF, 0x0C,
+    0x63, 0x08, 0xFF, 0xA2, 0x76, 0x3F, 0x8A, 0x01, 0xF9, 0x3F, 0x8A, 0x01, 0xF9, 0x3F, 0x8A, 0x01,
+    0xFF, 0xAC, 0x06, 0x3F, 0xDA, 0xEC, 0x01,
+};
+
+const SSD1963_Image img_dash_bg = { 800, 480, sizeof(dash_bg_data), dash_bg_data };
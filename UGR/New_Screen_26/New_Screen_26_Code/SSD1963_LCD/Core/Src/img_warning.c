@@ -0,0 +1,40 @@
+// Generated by Host/Tools/imgconv.py from warning.png, do not edit.
+//   imgconv.py warning.png --name warning --bg 282838
+// 48x48, 491 bytes (raw RGB565 4608 bytes, 10.7%)
+#include "ssd1963_image.h"
+
+static const uint8_t warning_data[] = {
+    0xBF, 0x67, 0x47, 0x29, 0x41, 0x85, 0x5A, 0x85, 0x5A, 0xED, 0x41, 0x01, 0xCD, 0x01, 0xCD, 0xEC,
+    0x43, 0x24, 0x7B, 0x40, 0xFE, 0x40, 0xFE, 0x24, 0x7B, 0xEB, 0x40, 0xA0, 0xE5, 0xC1, 0x40, 0xA0,
+    0xE5, 0xEA, 0x40, 0x24, 0x7B, 0x83, 0x40, 0xFE, 0x40, 0x24, 0x7B, 0xE8, 0x41, 0x86, 0x31, 0xE0,
+    0xF5, 0xC3, 0x41, 0xE0, 0xF5, 0x86, 0x31, 0xE7, 0x40, 0xC3, 0x93, 0x85, 0x40, 0xFE, 0x40, 0xC3,
+    0x93, 0xE6, 0x41, 0x86, 0x31, 0xE0, 0xF5, 0xC5, 0x41, 0xE0, 0xF5, 0x86, 0x31, 0xE5, 0x40, 0x03,
+    0xA4, 0x87, 0x40, 0xFE, 0x40, 0x03, 0xA4, 0xE4, 0x40, 0xC6, 0x41, 0x89, 0x40, 0xFE, 0x40, 0xC6,
+    0x41, 0xE3, 0x40, 0x62, 0xAC, 0xC9, 0x40, 0x62, 0xAC, 0xE2, 0x40, 0xC6, 0x41, 0x82, 0x40, 0xFE,
+    0x40, 0x61, 0x83, 0x83, 0x83, 0x10, 0x40, 0x61, 0x83, 0x82, 0x40, 0xFE, 0x40, 0xC6, 0x41, 0xE1,
+    0x40, 0x01, 0xCD, 0xCB, 0x40, 0x01, 0xCD, 0xE0, 0x40, 0x85, 0x5A, 0x83, 0x40, 0xFE, 0xC8, 0x41,
+    0x40, 0xFE, 0x85, 0x5A, 0xDF, 0x40, 0x01, 0xCD, 0xCD, 0x40, 0x01, 0xCD, 0xDE, 0x40, 0xC4, 0x6A,
+    0x84, 0x40, 0xFE, 0xC9, 0x41, 0x40, 0xFE, 0xC4, 0x6A, 0xDD, 0x40, 0xA0, 0xE5, 0xCF, 0x40, 0xA0,
+    0xE5, 0xDC, 0x40, 0x24, 0x7B, 0x85, 0x40, 0xFE, 0xCA, 0x41, 0x40, 0xFE, 0x24, 0x7B, 0xDA, 0x41,
+    0x86, 0x31, 0xA0, 0xE5, 0xD1, 0x41, 0xA0, 0xE5, 0x86, 0x31, 0xD9, 0x40, 0xC3, 0x93, 0x86, 0x40,
+    0xFE, 0xCB, 0x41, 0x40, 0xFE, 0xC3, 0x93, 0xD8, 0x41, 0x86, 0x31, 0xE0, 0xF5, 0xD3, 0x41, 0xE0,
+    0xF5, 0x86, 0x31, 0xD7, 0x40, 0xC3, 0x93, 0x87, 0x40, 0xFE, 0xCC, 0x41, 0x40, 0xFE, 0xC3, 0x93,
+    0xD6, 0x41, 0xC6, 0x41, 0xE0, 0xF5, 0xD5, 0x41, 0xE0, 0xF5, 0xC6, 0x41, 0xD5, 0x40, 0x62, 0xAC,
+    0x88, 0x40, 0xFE, 0xCD, 0x41, 0x40, 0xFE, 0x62, 0xAC, 0xD4, 0x40, 0xC6, 0x41, 0x89, 0x40, 0xFE,
+    0xCE, 0x41, 0x40, 0xFE, 0xC6, 0x41, 0xD3, 0x40, 0xA2, 0xBC, 0xD9, 0x40, 0xA2, 0xBC, 0xD2, 0x40,
+    0x85, 0x5A, 0x8A, 0x40, 0xFE, 0xCF, 0x41, 0x40, 0xFE, 0x85, 0x5A, 0xD1, 0x40, 0x01, 0xCD, 0xDB,
+    0x40, 0x01, 0xCD, 0xD0, 0x40, 0x85, 0x5A, 0x9D, 0x40, 0xFE, 0x40, 0x85, 0x5A, 0xCF, 0x40, 0xA0,
+    0xE5, 0xDD, 0x40, 0xA0, 0xE5, 0xCE, 0x40, 0x24, 0x7B, 0x9F, 0x40, 0xFE, 0x40, 0x24, 0x7B, 0xCD,
+    0x40, 0xA0, 0xE5, 0xCD, 0x43, 0x01, 0x7B, 0xC2, 0x18, 0xC2, 0x18, 0x01, 0x7B, 0xCD, 0x40, 0xA0,
+    0xE5, 0xCC, 0x40, 0x64, 0x83, 0x8D, 0x40, 0xFE, 0x40, 0x01, 0x7B, 0x83, 0x83, 0x10, 0x40, 0x01,
+    0x7B, 0x8D, 0x40, 0xFE, 0x40, 0x64, 0x83, 0xCA, 0x41, 0x86, 0x31, 0xE0, 0xF5, 0xCD, 0x40, 0xC2,
+    0x18, 0xC3, 0x40, 0xC2, 0x18, 0xCD, 0x41, 0xE0, 0xF5, 0x86, 0x31, 0xC9, 0x40, 0xC3, 0x93, 0x8E,
+    0x40, 0xFE, 0xD3, 0x41, 0x40, 0xFE, 0xC3, 0x93, 0xC8, 0x41, 0x86, 0x31, 0xE0, 0xF5, 0xCE, 0x40,
+    0x01, 0x7B, 0xC3, 0x40, 0x01, 0x7B, 0xCE, 0x41, 0xE0, 0xF5, 0x86, 0x31, 0xC7, 0x40, 0x62, 0xAC,
+    0x90, 0x40, 0xFE, 0x43, 0x01, 0x7B, 0xC2, 0x18, 0xC2, 0x18, 0x01, 0x7B, 0x90, 0x40, 0xFE, 0x40,
+    0x62, 0xAC, 0xC6, 0x40, 0xC6, 0x41, 0xA7, 0x40, 0xFE, 0x40, 0xC6, 0x41, 0xC5, 0x40, 0x62, 0xAC,
+    0xE7, 0x40, 0x62, 0xAC, 0xC4, 0x40, 0x85, 0x5A, 0xA9, 0x40, 0xFE, 0x40, 0x85, 0x5A, 0xC3, 0x40,
+    0x01, 0xCD, 0xE9, 0x40, 0x01, 0xCD, 0xBF, 0x82, 0x01, 0x47, 0x29,
+};
+
+const SSD1963_Image img_warning = { 48, 48, sizeof(warning_data), warning_data };
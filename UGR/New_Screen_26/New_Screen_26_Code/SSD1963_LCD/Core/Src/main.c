@@ -19,6 +19,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "can.h"
+#include "dma.h"
 #include "i2c.h"
 #include "spi.h"
 #include "tim.h"
@@ -30,7 +31,17 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
-
+#include "clock_profile.h"
+#include "boot.h"
+#include "can_rx.h"
+#include "can_signal.h"
+#include "can_tx.h"
+#include "ui_signal.h"
+#ifdef GFX_BENCH
+#include <stdio.h>
+#include "perf.h"
+#include "gfx_bench.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -51,6 +62,17 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
+// Colour test pattern, one step every MAIN_PATTERN_MS
+static const uint16_t main_pattern[] = {
+  RGB565(255, 0, 0), RGB565(0, 255, 0), RGB565(0, 0, 255), RGB565(255, 255, 255),
+};
+#define MAIN_PATTERN_MS   500u
+#define MAIN_STATS_MS     1000u
+
+// Display heartbeat: loop counter and receive health, every 100 ms and at most 10 ms late
+#define MAIN_HEARTBEAT_ID       0x370u
+#define MAIN_HEARTBEAT_MS       100u
+#define MAIN_HEARTBEAT_JITTER   10u
 
 /* USER CODE END PV */
 
@@ -63,6 +85,17 @@ static void MPU_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+_Static_assert(CANFLT_EXT == CANSIG_KEY_EXT, "filter and DBC keys mark 29-bit identifiers alike");
+
+// Hardware filters for exactly the DBC's messages; NULL (accept everything) if they do
+// not fit the filter banks
+static const CANFLT_Plan* main_can_filters(void)
+{
+  static CANFLT_Plan plan;
+  uint32_t keys[CANDB_MESSAGE_COUNT];
+  for (uint32_t i = 0; i < CANDB_MESSAGE_COUNT; i++) keys[i] = cansig_messages[i].key;
+  return CANFLT_Build(&plan, keys, CANDB_MESSAGE_COUNT, NULL) ? &plan : NULL;
+}
 
 /* USER CODE END 0 */
 
@@ -74,30 +107,43 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
-
+  BOOT_Start();
   /* USER CODE END 1 */
 
   /* MPU Configuration--------------------------------------------------------*/
   MPU_Config();
 
+  /* Enable the CPU Cache */
+
+  /* Enable I-Cache---------------------------------------------------------*/
+  SCB_EnableICache();
+
+  /* Enable D-Cache---------------------------------------------------------*/
+  SCB_EnableDCache();
+
   /* MCU Configuration--------------------------------------------------------*/
 
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  BOOT_Mark(BOOT_PHASE_HAL);
   /* USER CODE END Init */
 
   /* Configure the system clock */
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
+  // SystemClock_Config leaves us on HSI; switch to the clock_profile.h profile before
+  // the peripherals below derive their timings from it
+  CLK_ApplyProfile();
+  BOOT_Mark(BOOT_PHASE_CLOCK);
 
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_FMC_Init();
   MX_CAN2_Init();
   MX_I2C1_Init();
@@ -105,10 +151,30 @@ int main(void)
   MX_TIM12_Init();
   MX_USB_OTG_FS_PCD_Init();
   /* USER CODE BEGIN 2 */
-  // Start backlight PWM (your external brightness control on PB15)
-  HAL_TIM_PWM_Start(&htim12, TIM_CHANNEL_2);
-  __HAL_TIM_SET_COMPARE(&htim12, TIM_CHANNEL_2, __HAL_TIM_GET_AUTORELOAD(&htim12) / 2); // 50%
-  SSD1963_Init();
+  // MX_FMC_Init started the panel bring-up (boot.h); SysTick has been working through
+  // its waits during the inits above and keeps doing so during the bring-up below
+  BOOT_Mark(BOOT_PHASE_PERIPHERALS);
+
+  // Splash as soon as the controller is configured, then display and backlight on
+  BOOT_Splash();
+  BOOT_Print();
+#ifdef GFX_BENCH
+  {
+    static GFXBENCH_Result results[GFXBENCH_MAX_RESULTS];
+    PERF_Init();
+    GFXBENCH_Print(results, GFXBENCH_Run(results, GFXBENCH_MAX_RESULTS));
+    GFXBENCH_CacheCompare();
+  }
+#endif
+
+  // Receive from here on; the loop below drains the ring on every pass
+  CANRX_Start(&hcan2, main_can_filters());
+  CANTX_Start(&hcan2);
+  const uint8_t heartbeat = CANTX_AddPeriodic(MAIN_HEARTBEAT_ID, 0, 8, MAIN_HEARTBEAT_MS, MAIN_HEARTBEAT_JITTER);
+  uint32_t loops = 0;
+  uint32_t pattern_step = 0;
+  uint32_t pattern_at = HAL_GetTick() - MAIN_PATTERN_MS;
+  uint32_t stats_at = HAL_GetTick();
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -117,15 +183,44 @@ int main(void)
   while (1)
   {
     /* USER CODE END WHILE */
-    SSD1963_Fill(RGB565(255, 0, 0));   // solid red
-    HAL_Delay(500);
-    SSD1963_Fill(RGB565(0, 255, 0));   // solid green
-    HAL_Delay(500);
-    SSD1963_Fill(RGB565(0, 0, 255));   // solid blue
-    HAL_Delay(500);
-    SSD1963_Fill(RGB565(255, 255, 255)); // white
-    HAL_Delay(500);
+
     /* USER CODE BEGIN 3 */
+    // Every frame that arrived since the last pass, decoded a contiguous batch at a time
+    // into cansig_store; the ring keeps receiving while the fill below holds the loop
+    const CANRX_Frame* frames;
+    uint32_t n;
+    while ((n = CANRX_Peek(&frames)) != 0)
+    {
+      CANSIG_Decode(frames, n);
+      CANRX_Release(n);
+    }
+    // Widgets bound to the signals (UI_SignalBind) whose values moved go on the dirty list
+    UI_SignalPublish();
+
+    // Refreshed every pass; the scheduler sends whatever is current when the slot comes up
+    CANRX_Stats rx;
+    CANRX_GetStats(&rx);
+    const uint32_t dropped = rx.ring_full + rx.fifo_overrun;
+    const uint8_t beat[8] = {
+      (uint8_t)loops, (uint8_t)(loops >> 8), (uint8_t)(loops >> 16), (uint8_t)(loops >> 24),
+      (uint8_t)rx.received, (uint8_t)(rx.received >> 8), (uint8_t)dropped, (uint8_t)(dropped >> 8),
+    };
+    CANTX_SetData(heartbeat, beat, sizeof(beat));
+    loops++;
+
+    // Paced from the tick instead of HAL_Delay so the loop never sleeps with frames waiting
+    const uint32_t now = HAL_GetTick();
+    if (now - pattern_at >= MAIN_PATTERN_MS)
+    {
+      pattern_at = now;
+      SSD1963_Fill(main_pattern[pattern_step++ % (sizeof(main_pattern) / sizeof(main_pattern[0]))]);
+    }
+    if (now - stats_at >= MAIN_STATS_MS)
+    {
+      stats_at = now;
+      CANRX_Print();
+      CANTX_Print();
+    }
   }
   /* USER CODE END 3 */
 }
@@ -179,7 +274,12 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
-
+// printf() goes out over SWO (ITM stimulus port 0)
+int __io_putchar(int ch)
+{
+  ITM_SendChar((uint32_t)ch);
+  return ch;
+}
 /* USER CODE END 4 */
 
  /* MPU Configuration */
@@ -215,6 +315,44 @@ void MPU_Config(void)
   MPU_InitStruct.SubRegionDisable = 0x0;
   MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
   MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+
+  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+  /** Initializes and configures the Region and the memory to be protected
+  */
+  MPU_InitStruct.Number = MPU_REGION_NUMBER2;
+  MPU_InitStruct.BaseAddress = 0x20000000;
+  MPU_InitStruct.Size = MPU_REGION_SIZE_512KB;
+  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
+  MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+  MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+  MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+
+  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+  /** Initializes and configures the Region and the memory to be protected
+  */
+  MPU_InitStruct.Number = MPU_REGION_NUMBER3;
+  MPU_InitStruct.BaseAddress = 0x20070000;
+  MPU_InitStruct.Size = MPU_REGION_SIZE_64KB;
+  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
+  MPU_InitStruct.IsShareable = MPU_ACCESS_SHAREABLE;
+  MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
+  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+
+  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+
+  /** Initializes and configures the Region and the memory to be protected
+  */
+  MPU_InitStruct.Number = MPU_REGION_NUMBER4;
+  MPU_InitStruct.BaseAddress = 0x08000000;
+  MPU_InitStruct.Size = MPU_REGION_SIZE_1MB;
+  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
+  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
+  MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+  MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
 
   HAL_MPU_ConfigRegion(&MPU_InitStruct);
   /* Enables the MPU */
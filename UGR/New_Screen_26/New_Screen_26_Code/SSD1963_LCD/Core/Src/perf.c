@@ -0,0 +1,92 @@
+#include "perf.h"
+#include "main.h"
+#include "clock_profile.h"
+
+#ifdef SSD1963_HOST_SIM
+#include "ssd1963_sim.h"
+#endif
+
+PERF_BusCount perf_bus;
+
+void PERF_Init(void)
+{
+#ifndef SSD1963_HOST_SIM
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;  // Cortex-M7 DWT is locked out of reset
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    PERF_ResetBus();
+}
+
+uint32_t PERF_Cycles(void)
+{
+#ifdef SSD1963_HOST_SIM
+    return 0;
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+void PERF_DelayNs(uint32_t ns)
+{
+#ifdef SSD1963_HOST_SIM
+    SIM_AdvanceNs(ns);
+#else
+    const uint32_t cycles = (uint32_t)(((uint64_t)ns * SystemCoreClock) / 1000000000ULL);
+    const uint32_t start = DWT->CYCCNT;
+    while (DWT->CYCCNT - start < cycles) {}
+#endif
+}
+
+void PERF_GetBusTiming(PERF_BusTiming* t)
+{
+#ifdef SSD1963_HOST_SIM
+    // What CLK_ApplyFmcTiming programs for the selected clock profile
+    CLK_FmcTiming fmc;
+    CLK_LcdBusTiming(CLK_HCLK_HZ, &fmc);
+    t->hclk_hz = CLK_HCLK_HZ;
+    t->addset  = fmc.addset;
+    t->datast  = fmc.datast;
+    t->busturn = fmc.busturn;
+    t->rd_datast  = fmc.rd_datast;
+    t->rd_busturn = fmc.rd_busturn;
+#else
+    // Bank1/NE1: control BTCR[0], timing BTCR[1], write timing BWTR[0] in extended mode
+    const uint32_t btr = FMC_Bank1->BTCR[1];
+    const uint32_t bwtr = (FMC_Bank1->BTCR[0] & FMC_BCR1_EXTMOD) ? FMC_Bank1E->BWTR[0] : btr;
+    t->hclk_hz = HAL_RCC_GetHCLKFreq();
+    t->addset  = (uint8_t)((bwtr & FMC_BWTR1_ADDSET_Msk) >> FMC_BWTR1_ADDSET_Pos);
+    t->datast  = (uint8_t)((bwtr & FMC_BWTR1_DATAST_Msk) >> FMC_BWTR1_DATAST_Pos);
+    t->busturn = (uint8_t)((bwtr & FMC_BWTR1_BUSTURN_Msk) >> FMC_BWTR1_BUSTURN_Pos);
+    t->rd_datast  = (uint8_t)((btr & FMC_BTR1_DATAST_Msk) >> FMC_BTR1_DATAST_Pos);
+    t->rd_busturn = (uint8_t)((btr & FMC_BTR1_BUSTURN_Msk) >> FMC_BTR1_BUSTURN_Pos);
+#endif
+}
+
+uint32_t PERF_BusWriteCycles(const PERF_BusTiming* t)
+{
+    return (uint32_t)t->addset + (uint32_t)t->datast + 1u + (uint32_t)t->busturn;
+}
+
+uint32_t PERF_BusWriteNs(const PERF_BusTiming* t)
+{
+    return (uint32_t)(((uint64_t)PERF_BusWriteCycles(t) * 1000000000ULL) / t->hclk_hz);
+}
+
+uint32_t PERF_BusReadCycles(const PERF_BusTiming* t)
+{
+    return (uint32_t)t->addset + (uint32_t)t->rd_datast + 1u + (uint32_t)t->rd_busturn;
+}
+
+uint32_t PERF_BusReadNs(const PERF_BusTiming* t)
+{
+    return (uint32_t)(((uint64_t)PERF_BusReadCycles(t) * 1000000000ULL) / t->hclk_hz);
+}
+
+uint32_t PERF_BusTimeUs(const PERF_BusCount* c, const PERF_BusTiming* t)
+{
+    const uint64_t writes = (uint64_t)c->cmd_writes + c->data_writes + c->dma_beats;
+    const uint64_t cycles = writes * PERF_BusWriteCycles(t) + (uint64_t)c->data_reads * PERF_BusReadCycles(t);
+    return (uint32_t)((cycles * 1000000ULL) / t->hclk_hz);
+}
@@ -21,6 +21,7 @@
 #include "spi.h"
 
 /* USER CODE BEGIN 0 */
+#include "clock_profile.h"
 
 /* USER CODE END 0 */
 
@@ -56,6 +57,12 @@ void MX_SPI3_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN SPI3_Init 2 */
+  // Keep SCK at or below the 8 MHz CubeMX configured against the 16 MHz boot clock
+  hspi3.Init.BaudRatePrescaler = CLK_SpiPrescaler(HAL_RCC_GetPCLK1Freq(), CLK_CUBEMX_PCLK1_HZ / 2u);
+  if (HAL_SPI_Init(&hspi3) != HAL_OK)
+  {
+    Error_Handler();
+  }
 
   /* USER CODE END SPI3_Init 2 */
 
@@ -1,42 +1,28 @@
 #include "ssd1963.h"
+#include "ssd1963_bus.h"
 #include "main.h"
-#include "gpio.h"
-#include "fmc.h"
-#include "tim.h"
-#include "stm32f7xx_hal.h"
+#include "dma.h"
+#include "memory_map.h"
 
 // -----------------------------
-// FMC address mapping
+// Panel timing (ssd1963_panel.h)
 // -----------------------------
-// Bank1/NE1 base is 0x6000_0000.
-// With LCD_RS connected to FMC_A16, the "data" address is typically base + 0x20000 on a 16-bit bus.
-//
-// If you ever suspect RS is inverted, swap CMD/DATA addresses below.
-#define LCD_FMC_BASE   (0x60000000UL)
-#define LCD_CMD_ADDR   (LCD_FMC_BASE)
-#define LCD_DATA_ADDR  (LCD_FMC_BASE + 0x00020000UL)
+// PLL programmed by 0xE2 below: 10 MHz * (N+1) / (M+1) = 10 * 30 / 3
+#define SSD_PLL_HZ      100000000UL
+// 0xE6 LSHIFT frequency ratio: PCLK = PLL * (FPR + 1) / 2^20
+#define SSD_LSHIFT_FPR  ((uint32_t)((((uint64_t)SSD_PCLK_HZ) << 20) / SSD_PLL_HZ) - 1u)
 
-static inline void lcd_cmd(uint16_t c)  { *(__IO uint16_t*)LCD_CMD_ADDR  = c; }
-static inline void lcd_dat(uint16_t d)  { *(__IO uint16_t*)LCD_DATA_ADDR = d; }
+// Frame memory holds 24 bits per pixel whatever the interface format (1215 KB: 864x480)
+#define SSD_FRAME_BYTES (1215UL * 1024UL)
 
-// -----------------------------
-// Panel timing constants (from vendor example)
-// -----------------------------
-#define SSD_HOR_RESOLUTION      800
-#define SSD_VER_RESOLUTION      480
-
-#define SSD_HOR_PULSE_WIDTH     1
-#define SSD_HOR_BACK_PORCH      46
-#define SSD_HOR_FRONT_PORCH     210
-
-#define SSD_VER_PULSE_WIDTH     1
-#define SSD_VER_BACK_PORCH      23
-#define SSD_VER_FRONT_PORCH     22
-
-#define SSD_HT  (SSD_HOR_RESOLUTION + SSD_HOR_BACK_PORCH + SSD_HOR_FRONT_PORCH) // 1056
-#define SSD_HPS (SSD_HOR_BACK_PORCH)                                            // 46
-#define SSD_VT  (SSD_VER_RESOLUTION + SSD_VER_BACK_PORCH + SSD_VER_FRONT_PORCH) // 525
-#define SSD_VPS (SSD_VER_BACK_PORCH)                                            // 23
+_Static_assert(SSD_PANEL_PIXELS * 3u <= SSD_FRAME_BYTES,
+               "SSD1963_PANEL: panel does not fit the SSD1963 frame memory at 24 bpp");
+_Static_assert(SSD_LSHIFT_FPR < (1UL << 20), "SSD1963_PANEL: pixel clock must be below the PLL");
+_Static_assert(SSD_HOR_PULSE_WIDTH <= SSD_HOR_BACK_PORCH && SSD_VER_PULSE_WIDTH <= SSD_VER_BACK_PORCH,
+               "SSD1963_PANEL: sync pulse must end inside the back porch");
+_Static_assert(SSD_HT <= 4096 && SSD_VT <= 4096, "SSD1963_PANEL: 0xB4 / 0xB6 periods are 12 bits");
+// SSD1963_Fill streams whole 8-pixel bursts without a tail
+_Static_assert(SSD_PANEL_PIXELS % 8u == 0u, "SSD1963_PANEL: pixel count must be a multiple of 8");
 
 // Orientation: vendor example uses MADCTL (0x36). Many panels differ on BGR.
 // Start with BGR=0; if colors are swapped (red/blue), set BGR=1.
@@ -54,15 +40,151 @@ static void ssd_write_reg(uint16_t reg, const uint8_t* data, uint32_t n)
     for (uint32_t i = 0; i < n; i++) lcd_dat(data[i]);
 }
 
-static void ssd_soft_reset(void)
+// -----------------------------
+// Pixel streams
+// -----------------------------
+#ifdef SSD1963_HOST_SIM
+static inline void ssd_fill_bursts(uint16_t d, uint32_t bursts)
 {
-    lcd_cmd(0x01);
-    HAL_Delay(10);
+    for (uint32_t i = 0; i < bursts * 8u; i++) SIM_BusData(d);
 }
 
-// Set column/page address + memory write
-void SSD1963_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+void lcd_dat_fill(uint16_t d, uint32_t n)
+{
+    LCD_BUS_COUNT(data_writes, n);
+    while (n-- > 0) SIM_BusData(d);
+}
+
+void lcd_dat_copy(const uint16_t* src, uint32_t n)
+{
+    LCD_BUS_COUNT(data_writes, n);
+    while (n-- > 0) SIM_BusData(*src++);
+}
+#else
+// The data port is Device memory (MPU_Config region 1), so the core neither merges nor
+// reorders these stores, and a store multiple that has started is not abandoned and
+// replayed for an interrupt. Each STM of 4 words covers LCD_DATA_ADDR .. +15.
+// 8 pixels per STM; inlined with a constant count where the size is known at build time
+static inline void ssd_fill_bursts(uint16_t d, uint32_t bursts)
+{
+    volatile uint32_t* const port = (volatile uint32_t*)LCD_DATA_ADDR;
+    register uint32_t w0 __asm("r2") = (uint32_t)d | ((uint32_t)d << 16);
+    register uint32_t w1 __asm("r3") = w0;
+    register uint32_t w2 __asm("r4") = w0;
+    register uint32_t w3 __asm("r5") = w0;
+
+    for (; bursts > 0u; bursts--)
+    {
+        __asm volatile("stm %0, {%1, %2, %3, %4}"
+                       : : "r"(port), "r"(w0), "r"(w1), "r"(w2), "r"(w3) : "memory");
+    }
+}
+
+void lcd_dat_fill(uint16_t d, uint32_t n)
+{
+    LCD_BUS_COUNT(data_writes, n);
+
+    ssd_fill_bursts(d, n / 8u);
+    n &= 7u;
+
+    volatile uint32_t* const port = (volatile uint32_t*)LCD_DATA_ADDR;
+    const uint32_t w = (uint32_t)d | ((uint32_t)d << 16);
+    for (; n >= 2u; n -= 2u) *port = w;
+    if (n != 0u) *(volatile uint16_t*)LCD_DATA_ADDR = d;
+}
+
+void lcd_dat_copy(const uint16_t* src, uint32_t n)
+{
+    LCD_BUS_COUNT(data_writes, n);
+    if (n == 0u) return;
+
+    // Pixel arrays are only halfword aligned: send one on its own to align the loads
+    if (((uintptr_t)src & 2u) != 0u)
+    {
+        *(volatile uint16_t*)LCD_DATA_ADDR = *src++;
+        n--;
+    }
+
+    volatile uint32_t* const port = (volatile uint32_t*)LCD_DATA_ADDR;
+    const uint32_t* s = (const uint32_t*)src;
+    for (; n >= 8u; n -= 8u)
+    {
+        __asm volatile("ldm %0!, {r2, r3, r4, r5}\n\t"
+                       "stm %1, {r2, r3, r4, r5}"
+                       : "+r"(s) : "r"(port) : "r2", "r3", "r4", "r5", "memory");
+    }
+    for (; n >= 2u; n -= 2u) *port = *s++;
+    if (n != 0u) *(volatile uint16_t*)LCD_DATA_ADDR = *(const uint16_t*)s;
+}
+#endif
+
+// -----------------------------
+// Asynchronous fill and blit state (DMA2_Stream0, memory-to-memory)
+// -----------------------------
+// Source is a single halfword (fills, PINC off) or a pixel array (blits, PINC on);
+// the destination is always the FMC data port (MINC off).
+// NDTR is 16 bits, so anything bigger than 65535 pixels is chained from the TC interrupt.
+#define SSD_DMA_MAX_BEATS  65535UL
+
+// DMA2 reads the colour straight from SRAM, so it must not sit in a dirty cache line
+static uint16_t ssd_fill_colour MEM_DMA_BUFFER;
+static const uint16_t* ssd_dma_src;
+static uint8_t ssd_dma_src_inc;
+static volatile uint32_t ssd_fill_remaining;
+static volatile uint8_t ssd_dma_busy;
+static SSD1963_DoneCallback ssd_fill_done;
+
+static void ssd_dma_start_chunk(void)
+{
+    uint32_t beats = ssd_fill_remaining;
+    if (beats > SSD_DMA_MAX_BEATS) beats = SSD_DMA_MAX_BEATS;
+    ssd_fill_remaining -= beats;
+
+    const uint16_t* src = ssd_dma_src;
+    if (ssd_dma_src_inc) ssd_dma_src += beats;
+
+    if (lcd_dma_start(src, beats, ssd_dma_src_inc) != HAL_OK)
+    {
+        Error_Handler();
+    }
+}
+
+static void ssd_dma_xfer_cplt(DMA_HandleTypeDef* hdma)
 {
+    (void)hdma;
+
+    if (ssd_fill_remaining)
+    {
+        ssd_dma_start_chunk();
+        return;
+    }
+
+    ssd_dma_busy = 0;
+    if (ssd_fill_done) ssd_fill_done();
+}
+
+static void ssd_dma_xfer_error(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    Error_Handler();
+}
+
+uint8_t SSD1963_IsBusy(void)
+{
+    return ssd_dma_busy;
+}
+
+void SSD1963_WaitIdle(void)
+{
+    while (ssd_dma_busy) { }
+}
+
+// Set column/page address
+static void ssd_set_area(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    // Don't move the window under a fill that is still streaming
+    SSD1963_WaitIdle();
+
     // 0x2A: column address set
     lcd_cmd(0x2A);
     lcd_dat((x0 >> 8) & 0xFF);
@@ -76,66 +198,222 @@ void SSD1963_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
     lcd_dat(y0 & 0xFF);
     lcd_dat((y1 >> 8) & 0xFF);
     lcd_dat(y1 & 0xFF);
+}
+
+// Set column/page address + memory write
+void SSD1963_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    ssd_set_area(x0, y0, x1, y1);
 
     // 0x2C: memory write
     lcd_cmd(0x2C);
 }
 
+// -----------------------------
+// Frame memory read-back
+// -----------------------------
+void SSD1963_ReadWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    ssd_set_area(x0, y0, x1, y1);
+
+    // 0x2E: memory read
+    lcd_cmd(0x2E);
+}
+
+void SSD1963_ReadContinue(void)
+{
+    SSD1963_WaitIdle();
+
+    // 0x3E: memory read continue, from where the last read stopped
+    lcd_cmd(0x3E);
+}
+
+void SSD1963_ReadPixels(uint16_t* out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) out[i] = lcd_rd();
+}
+
 void SSD1963_Fill(uint16_t rgb565)
 {
     SSD1963_SetWindow(0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1);
 
-    const uint32_t pixels = (uint32_t)SSD_HOR_RESOLUTION * (uint32_t)SSD_VER_RESOLUTION;
-    for (uint32_t i = 0; i < pixels; i++)
-    {
-        // 16-bit 565 on 16-bit parallel bus
-        *(__IO uint16_t*)LCD_DATA_ADDR = rgb565;
-    }
+    // 16-bit 565 on 16-bit parallel bus, two pixels per store, no tail (checked above)
+    LCD_BUS_COUNT(data_writes, SSD_PANEL_PIXELS);
+    ssd_fill_bursts(rgb565, SSD_PANEL_PIXELS / 8u);
+}
+
+static void ssd_dma_begin(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                          const uint16_t* src, uint8_t src_inc, SSD1963_DoneCallback done)
+{
+    SSD1963_SetWindow(x0, y0, x1, y1);
+
+    ssd_dma_src = src;
+    ssd_dma_src_inc = src_inc;
+    ssd_fill_done = done;
+    ssd_fill_remaining = (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1);
+    ssd_dma_busy = 1;
+
+    hdma_memtomem_dma2_stream0.XferCpltCallback = ssd_dma_xfer_cplt;
+    hdma_memtomem_dma2_stream0.XferErrorCallback = ssd_dma_xfer_error;
+    ssd_dma_start_chunk();
+}
+
+void SSD1963_FillRectAsync(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                           uint16_t rgb565, SSD1963_DoneCallback done)
+{
+    // Cut to the panel; nothing left (or reversed corners) starts nothing
+    if (x1 > SSD_HOR_RESOLUTION - 1) x1 = SSD_HOR_RESOLUTION - 1;
+    if (y1 > SSD_VER_RESOLUTION - 1) y1 = SSD_VER_RESOLUTION - 1;
+    if (x0 > x1 || y0 > y1) return;
+
+    // A fill still streaming reads ssd_fill_colour: let it finish before replacing it
+    SSD1963_WaitIdle();
+    ssd_fill_colour = rgb565;
+    ssd_dma_begin(x0, y0, x1, y1, &ssd_fill_colour, 0, done);
+}
+
+void SSD1963_BlitAsync(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+                       const uint16_t* pixels, SSD1963_DoneCallback done)
+{
+    // The source has no stride to clip with: the window must lie on the panel as given
+    if (x0 > x1 || y0 > y1 || x1 > SSD_HOR_RESOLUTION - 1 || y1 > SSD_VER_RESOLUTION - 1) return;
+
+    ssd_dma_begin(x0, y0, x1, y1, pixels, 1, done);
+}
+
+void SSD1963_FillAsync(uint16_t rgb565, SSD1963_DoneCallback done)
+{
+    SSD1963_FillRectAsync(0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1, rgb565, done);
+}
+
+// -----------------------------
+// Scan position and tearing effect
+// -----------------------------
+void SSD1963_GetScanTiming(SSD1963_ScanTiming* t)
+{
+    const uint64_t pclk_hz = ((uint64_t)SSD_PLL_HZ * (SSD_LSHIFT_FPR + 1u)) >> 20;
+
+    t->lines = SSD_VT;
+    t->first_row = SSD_VPS;
+    t->line_ns = (uint32_t)(((uint64_t)SSD_HT * 1000000000ULL) / pclk_hz);
+}
+
+uint16_t SSD1963_GetScanline(void)
+{
+    // The read would land in the middle of a DMA fill's data stream
+    SSD1963_WaitIdle();
+
+    lcd_cmd(0x45);
+    const uint16_t hi = lcd_rd() & 0xFF;
+    const uint16_t lo = lcd_rd() & 0xFF;
+    return (uint16_t)((hi << 8) | lo);
+}
+
+void SSD1963_SetTearOn(uint8_t mode)
+{
+    SSD1963_WaitIdle();
+    ssd_write_reg8(0x35, mode & 0x01);
+}
+
+void SSD1963_SetTearOff(void)
+{
+    SSD1963_WaitIdle();
+    lcd_cmd(0x34);
+}
+
+// TE goes active when the controller reaches line (0x44 set_tear_scanline)
+void SSD1963_SetTearScanline(uint16_t line)
+{
+    const uint8_t p[] = { (uint8_t)(line >> 8), (uint8_t)(line & 0xFF) };
+
+    SSD1963_WaitIdle();
+    ssd_write_reg(0x44, p, sizeof(p));
+}
+
+// -----------------------------
+// Vertical scrolling
+// -----------------------------
+void SSD1963_SetScrollArea(uint16_t tfa, uint16_t vsa, uint16_t bfa)
+{
+    const uint8_t p[] = {
+        (uint8_t)(tfa >> 8), (uint8_t)(tfa & 0xFF),
+        (uint8_t)(vsa >> 8), (uint8_t)(vsa & 0xFF),
+        (uint8_t)(bfa >> 8), (uint8_t)(bfa & 0xFF)
+    };
+
+    SSD1963_WaitIdle();
+    ssd_write_reg(0x33, p, sizeof(p));
+}
+
+void SSD1963_SetScrollStart(uint16_t line)
+{
+    const uint8_t p[] = { (uint8_t)(line >> 8), (uint8_t)(line & 0xFF) };
+
+    SSD1963_WaitIdle();
+    ssd_write_reg(0x37, p, sizeof(p));
 }
 
 static void ssd_set_madctl_landscape(void)
 {
     // Vendor example maps "USE_HORIZONTAL=1" to MADCTL value 0x00 (with their setup).
     // We add optional BGR bit (bit3).
+    // Bit 4 (line address order) stays 0: panel rows are refreshed top to bottom, which
+    // is what the scroll area arithmetic in SSD1963_SetScrollStart assumes.
     uint8_t madctl = 0x00;
     if (SSD1963_BGR) madctl |= (1u << 3);
     ssd_write_reg8(0x36, madctl);
 }
 
-void SSD1963_Init(void)
+// -----------------------------
+// Bring-up
+// -----------------------------
+// The vendor sequence as steps, each followed by the wait the controller needs before
+// the next one. The waits add up to about 100 ms, which SSD1963_InitStep leaves to the
+// caller instead of spending them in HAL_Delay.
+
+// ---- Hardware reset pin (PC5 in your design) ----
+// Make sure PC5 is labeled LCD_RESET in CubeMX so these macros exist.
+static void ssd_init_reset(void)
 {
-    // ---- Hardware reset pin (PC5 in your design) ----
-    // Make sure PC5 is labeled LCD_RESET in CubeMX so these macros exist.
     HAL_GPIO_WritePin(LCD_RESET_GPIO_Port, LCD_RESET_Pin, GPIO_PIN_RESET);
-    HAL_Delay(20);
+}
+
+static void ssd_init_release(void)
+{
     HAL_GPIO_WritePin(LCD_RESET_GPIO_Port, LCD_RESET_Pin, GPIO_PIN_SET);
-    HAL_Delay(50);
+}
 
-    // ---- SSD1963 init (ported from vendor example) ----
+// ---- SSD1963 init (ported from vendor example) ----
 
-    // Set PLL (vendor comment assumes SSD1963 OSC=10MHz)
-    // 0xE2: PLL configuration
-    {
-        const uint8_t pll[] = {
-            0x1D, // N
-            0x02, // M
-            0x04  // validate
-        };
-        ssd_write_reg(0xE2, pll, sizeof(pll));
-    }
-    HAL_Delay(1);
+// Set PLL (vendor comment assumes SSD1963 OSC=10MHz)
+// 0xE2: PLL configuration
+static void ssd_init_pll(void)
+{
+    const uint8_t pll[] = {
+        0x1D, // N
+        0x02, // M
+        0x04  // validate
+    };
+    ssd_write_reg(0xE2, pll, sizeof(pll));
+}
 
-    // 0xE0: start PLL
-    ssd_write_reg8(0xE0, 0x01);
-    HAL_Delay(10);
-    ssd_write_reg8(0xE0, 0x03);
-    HAL_Delay(12);
+// 0xE0: start PLL, then lock onto it
+static void ssd_init_pll_start(void) { ssd_write_reg8(0xE0, 0x01); }
+static void ssd_init_pll_lock(void)  { ssd_write_reg8(0xE0, 0x03); }
 
-    ssd_soft_reset();
+static void ssd_init_soft_reset(void) { lcd_cmd(0x01); }
 
-    // 0xE6: pixel clock (vendor sets 0x03,0xFF,0xFF)
+// Panel timing, interface format and orientation. The display stays off, so whatever
+// frame memory holds after reset is not shown until SSD1963_DisplayOn.
+static void ssd_init_configure(void)
+{
+    // 0xE6: pixel clock (vendor sets 0x03,0xFF,0xFF for 25 MHz)
     {
-        const uint8_t pclk[] = { 0x03, 0xFF, 0xFF };
+        const uint8_t pclk[] = {
+            (uint8_t)(SSD_LSHIFT_FPR >> 16),
+            (uint8_t)(SSD_LSHIFT_FPR >> 8),
+            (uint8_t)(SSD_LSHIFT_FPR & 0xFF)
+        };
         ssd_write_reg(0xE6, pclk, sizeof(pclk));
     }
 
@@ -174,7 +452,7 @@ void SSD1963_Init(void)
             (uint8_t)((SSD_VT - 1) & 0xFF),
             (uint8_t)(SSD_VPS >> 8),
             (uint8_t)(SSD_VPS & 0xFF),
-            (uint8_t)(SSD_VER_FRONT_PORCH - 1),
+            (uint8_t)(SSD_VER_PULSE_WIDTH - 1),
             0x00, 0x00
         };
         ssd_write_reg(0xB6, b6, sizeof(b6));
@@ -183,9 +461,6 @@ void SSD1963_Init(void)
     // 0xF0: set CPU interface to 16-bit (565 for 16bpp)
     ssd_write_reg8(0xF0, 0x03);
 
-    // Display ON
-    lcd_cmd(0x29);
-
     // Disable DBC (vendor: 0xD0 0x00)
     ssd_write_reg8(0xD0, 0x00);
 
@@ -201,3 +476,65 @@ void SSD1963_Init(void)
     // MADCTL orientation
     ssd_set_madctl_landscape();
 }
+
+typedef struct
+{
+    void (*run)(void);
+    uint8_t wait_ms;        // before the next step may run
+} SSD_InitStep;
+
+static const SSD_InitStep ssd_init_steps[] = {
+    { ssd_init_reset,       20 },
+    { ssd_init_release,     50 },
+    { ssd_init_pll,         1 },
+    { ssd_init_pll_start,   10 },
+    { ssd_init_pll_lock,    12 },
+    { ssd_init_soft_reset,  10 },
+    { ssd_init_configure,   0 },
+};
+
+#define SSD_INIT_STEPS  (sizeof(ssd_init_steps) / sizeof(ssd_init_steps[0]))
+
+static volatile uint8_t ssd_init_next = SSD_INIT_STEPS;
+static uint32_t ssd_init_tick;
+
+void SSD1963_InitStart(void)
+{
+    ssd_init_steps[0].run();
+    ssd_init_tick = HAL_GetTick();
+    ssd_init_next = 1;
+}
+
+uint32_t SSD1963_InitStep(void)
+{
+    while (ssd_init_next < SSD_INIT_STEPS)
+    {
+        // One tick more than the wait, as HAL_Delay does: the first tick may be partial
+        const uint32_t due = (uint32_t)ssd_init_steps[ssd_init_next - 1].wait_ms + 1u;
+        const uint32_t elapsed = HAL_GetTick() - ssd_init_tick;
+        if (elapsed < due) return due - elapsed;
+
+        ssd_init_steps[ssd_init_next].run();
+        ssd_init_tick = HAL_GetTick();
+        ssd_init_next++;
+    }
+    return 0;
+}
+
+uint8_t SSD1963_InitDone(void)
+{
+    return ssd_init_next >= SSD_INIT_STEPS;
+}
+
+void SSD1963_DisplayOn(uint8_t on)
+{
+    SSD1963_WaitIdle();
+    lcd_cmd(on ? 0x29 : 0x28);
+}
+
+void SSD1963_Init(void)
+{
+    SSD1963_InitStart();
+    for (uint32_t ms; (ms = SSD1963_InitStep()) != 0; ) HAL_Delay(ms);
+    SSD1963_DisplayOn(1);
+}
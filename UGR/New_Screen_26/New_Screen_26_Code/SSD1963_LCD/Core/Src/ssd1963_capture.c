@@ -0,0 +1,68 @@
+#include "ssd1963_capture.h"
+#include "ssd1963.h"
+
+#include <stdio.h>
+
+// -----------------------------
+// Row buffers
+// -----------------------------
+static uint16_t capture_row[SSD_HOR_RESOLUTION];
+static uint8_t capture_bytes[SSD_HOR_RESOLUTION * 3];
+
+static uint32_t capture_pack(const uint16_t* px, uint32_t n, SSD1963_CaptureFormat format)
+{
+    uint8_t* o = capture_bytes;
+
+    if (format == SSD1963_CAPTURE_PPM)
+    {
+        for (uint32_t i = 0; i < n; i++)
+        {
+            const uint32_t r = px[i] >> 11, g = (px[i] >> 5) & 0x3Fu, b = px[i] & 0x1Fu;
+            *o++ = (uint8_t)((r << 3) | (r >> 2));
+            *o++ = (uint8_t)((g << 2) | (g >> 4));
+            *o++ = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0; i < n; i++)
+        {
+            *o++ = (uint8_t)px[i];
+            *o++ = (uint8_t)(px[i] >> 8);
+        }
+    }
+    return (uint32_t)(o - capture_bytes);
+}
+
+uint8_t SSD1963_Capture(const SSD1963_Rect* area, SSD1963_CaptureFormat format,
+                        SSD1963_CaptureSink sink, void* ctx)
+{
+    const int16_t x0 = (area->x0 > 0) ? area->x0 : 0;
+    const int16_t y0 = (area->y0 > 0) ? area->y0 : 0;
+    const int16_t x1 = (area->x1 < SSD_HOR_RESOLUTION - 1) ? area->x1 : SSD_HOR_RESOLUTION - 1;
+    const int16_t y1 = (area->y1 < SSD_VER_RESOLUTION - 1) ? area->y1 : SSD_VER_RESOLUTION - 1;
+    if (x0 > x1 || y0 > y1) return 0;
+
+    const uint32_t w = (uint32_t)(x1 - x0 + 1);
+
+    if (format == SSD1963_CAPTURE_PPM)
+    {
+        char header[24];
+        const int n = snprintf(header, sizeof(header), "P6\n%lu %lu\n255\n",
+                               (unsigned long)w, (unsigned long)(y1 - y0 + 1));
+        if (!sink(ctx, (const uint8_t*)header, (uint32_t)n)) return 0;
+    }
+
+    SSD1963_ReadWindow((uint16_t)x0, (uint16_t)y0, (uint16_t)x1, (uint16_t)y1);
+    for (int32_t y = y0; y <= y1; y++)
+    {
+        // Commands that leave the window alone (a scanline query from the vsync scheduler)
+        // may have reached the controller while the sink ran; 0x3E resumes the read where
+        // it stopped. Nothing that moves the window may draw during a capture.
+        if (y != y0) SSD1963_ReadContinue();
+
+        SSD1963_ReadPixels(capture_row, w);
+        if (!sink(ctx, capture_bytes, capture_pack(capture_row, w, format))) return 0;
+    }
+    return 1;
+}
@@ -0,0 +1,319 @@
+#include "ssd1963_font.h"
+#include "ssd1963_gfx.h"
+#include "ssd1963_bus.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Blending
+// -----------------------------
+// One colour per coverage level, blended per RGB565 channel. Rebuilt only when the
+// colours or the depth change, which within one string they never do.
+static uint16_t font_lut[16];
+static uint16_t font_lut_fg, font_lut_bg;
+static uint8_t font_lut_bpp;
+
+static uint16_t font_mix(uint16_t fg, uint16_t bg, uint32_t a, uint32_t max)
+{
+    const uint32_t r = (((fg >> 11) & 0x1Fu) * a + ((bg >> 11) & 0x1Fu) * (max - a) + max / 2u) / max;
+    const uint32_t g = (((fg >> 5) & 0x3Fu) * a + ((bg >> 5) & 0x3Fu) * (max - a) + max / 2u) / max;
+    const uint32_t b = ((fg & 0x1Fu) * a + (bg & 0x1Fu) * (max - a) + max / 2u) / max;
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void font_build_lut(uint16_t fg, uint16_t bg, uint8_t bpp)
+{
+    if (font_lut_bpp == bpp && font_lut_fg == fg && font_lut_bg == bg) return;
+
+    const uint32_t max = (1u << bpp) - 1u;
+    for (uint32_t a = 0; a <= max; a++) font_lut[a] = font_mix(fg, bg, a, max);
+
+    font_lut_fg = fg;
+    font_lut_bg = bg;
+    font_lut_bpp = bpp;
+}
+
+// Expand row of glyph g from the packed bitmap through font_lut
+static void font_decode_row(const SSD1963_Font* font, const SSD1963_Glyph* g, uint32_t row, uint16_t* out)
+{
+    const uint8_t bpp = font->bpp;
+    const uint8_t mask = (uint8_t)((1u << bpp) - 1u);
+    const uint8_t* src = font->bitmap + g->offset;
+    uint32_t bit = row * g->width * bpp;
+
+    for (uint32_t x = 0; x < g->width; x++, bit += bpp)
+    {
+        const uint8_t byte = src[bit >> 3];
+        out[x] = font_lut[(byte >> (8u - bpp - (bit & 7u))) & mask];
+    }
+}
+
+void SSD1963_GlyphCoverage(const SSD1963_Font* font, const SSD1963_Glyph* g, uint32_t row, uint8_t* out)
+{
+    const uint8_t bpp = font->bpp;
+    const uint8_t mask = (uint8_t)((1u << bpp) - 1u);
+    const uint8_t scale = (uint8_t)(255u / mask);
+    const uint8_t* src = font->bitmap + g->offset;
+    uint32_t bit = row * g->width * bpp;
+
+    for (uint32_t x = 0; x < g->width; x++, bit += bpp)
+        out[x] = (uint8_t)(((src[bit >> 3] >> (8u - bpp - (bit & 7u))) & mask) * scale);
+}
+
+// -----------------------------
+// Glyph cache
+// -----------------------------
+// Blended boxes are allocated FIFO from a ring of pixels; the slot ring records them
+// oldest first, so making room is always "drop the oldest until the new box fits".
+typedef struct
+{
+    const SSD1963_Font* font;
+    uint16_t fg, bg;
+    uint16_t offset;            // first pixel in font_pool
+    char code;
+} FontSlot;
+
+static uint16_t font_pool[SSD1963_GLYPH_CACHE_PIXELS];
+static uint32_t font_pool_head;
+
+static FontSlot font_slots[SSD1963_GLYPH_CACHE_SLOTS];
+static uint32_t font_slot_first;
+static uint32_t font_slot_count;
+
+static SSD1963_FontCacheStats font_stats;
+
+_Static_assert(SSD1963_GLYPH_CACHE_PIXELS <= 0xFFFF, "slot offsets are 16-bit");
+
+static void font_evict_oldest(void)
+{
+    font_slot_first = (font_slot_first + 1u) % SSD1963_GLYPH_CACHE_SLOTS;
+    font_slot_count--;
+    font_stats.evictions++;
+}
+
+static uint32_t font_alloc(uint32_t pixels)
+{
+    for (;;)
+    {
+        if (font_slot_count == 0)
+        {
+            font_pool_head = 0;
+            break;
+        }
+        if (font_slot_count < SSD1963_GLYPH_CACHE_SLOTS)
+        {
+            const uint32_t oldest = font_slots[font_slot_first].offset;
+            if (font_pool_head > oldest)
+            {
+                // Live pixels are [oldest, head): free space at the end, then at the start
+                if (font_pool_head + pixels <= SSD1963_GLYPH_CACHE_PIXELS) break;
+                if (pixels <= oldest)
+                {
+                    font_pool_head = 0;
+                    break;
+                }
+            }
+            else if (font_pool_head + pixels <= oldest)
+            {
+                break;
+            }
+        }
+        font_evict_oldest();
+    }
+
+    const uint32_t offset = font_pool_head;
+    font_pool_head += pixels;
+    return offset;
+}
+
+static const uint16_t* font_cached(const SSD1963_Font* font, const SSD1963_Glyph* g, char c,
+                                   uint16_t fg, uint16_t bg)
+{
+    for (uint32_t i = 0; i < font_slot_count; i++)
+    {
+        const FontSlot* s = &font_slots[(font_slot_first + i) % SSD1963_GLYPH_CACHE_SLOTS];
+        if (s->code == c && s->font == font && s->fg == fg && s->bg == bg)
+        {
+            font_stats.hits++;
+            return &font_pool[s->offset];
+        }
+    }
+
+    const uint32_t pixels = (uint32_t)g->width * g->height;
+    if (pixels > SSD1963_GLYPH_CACHE_PIXELS)
+    {
+        font_stats.uncached++;
+        return NULL;
+    }
+
+    const uint32_t offset = font_alloc(pixels);
+    FontSlot* s = &font_slots[(font_slot_first + font_slot_count) % SSD1963_GLYPH_CACHE_SLOTS];
+    font_slot_count++;
+    font_stats.misses++;
+
+    s->font = font;
+    s->code = c;
+    s->fg = fg;
+    s->bg = bg;
+    s->offset = (uint16_t)offset;
+
+    font_build_lut(fg, bg, font->bpp);
+    for (uint32_t row = 0; row < g->height; row++)
+        font_decode_row(font, g, row, &font_pool[offset + row * g->width]);
+
+    return &font_pool[offset];
+}
+
+void SSD1963_FontCacheFlush(void)
+{
+    font_slot_first = 0;
+    font_slot_count = 0;
+    font_pool_head = 0;
+}
+
+void SSD1963_GetFontCacheStats(SSD1963_FontCacheStats* out)
+{
+    *out = font_stats;
+}
+
+// -----------------------------
+// Drawing
+// -----------------------------
+const SSD1963_Glyph* SSD1963_FontGlyph(const SSD1963_Font* font, char c)
+{
+    const uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last) return NULL;
+
+    const SSD1963_Glyph* g = &font->glyphs[code - font->first];
+    return (g->advance != 0) ? g : NULL;
+}
+
+static inline void font_run(uint16_t colour, int32_t n)
+{
+    if (n > 0) lcd_dat_fill(colour, (uint32_t)n);
+}
+
+// Cell of one glyph: its advance, widened to the bitmap box where the box overhangs,
+// but never left of *left so a string does not erase the previous glyph's overhang.
+// Returns the pen position after the glyph and moves *left past the cell.
+static int16_t font_draw_glyph(int16_t x, int16_t y, const SSD1963_Font* font, const SSD1963_Glyph* g,
+                               char c, uint16_t fg, uint16_t bg, int32_t* left)
+{
+    const int32_t box_x0 = x + g->x_off;
+    const int32_t box_y0 = y + font->ascent + g->y_off;
+    const int32_t box_x1 = box_x0 + g->width - 1;
+    const int32_t box_y1 = box_y0 + g->height - 1;
+
+    int32_t cell_x0 = (g->width && box_x0 < x) ? box_x0 : x;
+    int32_t cell_x1 = x + g->advance - 1;
+    if (g->width && box_x1 > cell_x1) cell_x1 = box_x1;
+    if (cell_x0 < *left) cell_x0 = *left;
+    *left = cell_x1 + 1;
+
+    const int16_t pen = (int16_t)(x + g->advance);
+    if (cell_x0 > cell_x1 || cell_x0 > INT16_MAX || cell_x1 < INT16_MIN) return pen;
+
+    const SSD1963_Rect cell = { (int16_t)cell_x0, y, (int16_t)cell_x1, (int16_t)(y + font->line_height - 1) };
+    SSD1963_Rect vis;
+    if (!SSD1963_ClipRect(&cell, &vis)) return pen;
+
+    const uint16_t* pixels = NULL;
+    uint16_t row_buf[255];
+    if (g->width)
+    {
+        pixels = font_cached(font, g, c, fg, bg);
+        if (pixels == NULL) font_build_lut(fg, bg, font->bpp);
+    }
+
+    // Visible columns of the box, and the background runs either side of them
+    int32_t gx0 = (box_x0 > vis.x0) ? box_x0 : vis.x0;
+    int32_t gx1 = (box_x1 < vis.x1) ? box_x1 : vis.x1;
+    if (!g->width || gx0 > gx1)
+    {
+        gx0 = vis.x1 + 1;
+        gx1 = vis.x1;
+    }
+    const int32_t lead = gx0 - vis.x0;
+    const int32_t trail = vis.x1 - gx1;
+    const int32_t cols = vis.x1 - vis.x0 + 1;
+
+    SSD1963_SetWindow((uint16_t)vis.x0, (uint16_t)vis.y0, (uint16_t)vis.x1, (uint16_t)vis.y1);
+
+    for (int32_t yy = vis.y0; yy <= vis.y1; yy++)
+    {
+        if (yy < box_y0 || yy > box_y1 || gx0 > gx1)
+        {
+            font_run(bg, cols);
+            continue;
+        }
+
+        const uint32_t row = (uint32_t)(yy - box_y0);
+        const uint16_t* src;
+        if (pixels)
+        {
+            src = pixels + row * g->width;
+        }
+        else
+        {
+            font_decode_row(font, g, row, row_buf);
+            src = row_buf;
+        }
+
+        font_run(bg, lead);
+        if (gx1 >= gx0) lcd_dat_copy(&src[gx0 - box_x0], (uint32_t)(gx1 - gx0 + 1));
+        font_run(bg, trail);
+    }
+
+    return pen;
+}
+
+int16_t SSD1963_DrawChar(int16_t x, int16_t y, const SSD1963_Font* font, char c,
+                         uint16_t fg, uint16_t bg)
+{
+    const SSD1963_Glyph* g = SSD1963_FontGlyph(font, c);
+    if (g == NULL) return x;
+
+    int32_t left = INT32_MIN;
+    return font_draw_glyph(x, y, font, g, c, fg, bg, &left);
+}
+
+int16_t SSD1963_DrawText(int16_t x, int16_t y, const SSD1963_Font* font, const char* text,
+                         uint16_t fg, uint16_t bg)
+{
+    int16_t pen = x;
+    int32_t left = INT32_MIN;
+
+    for (; *text; text++)
+    {
+        if (*text == '\n')
+        {
+            y = (int16_t)(y + font->line_height);
+            pen = x;
+            left = INT32_MIN;
+            continue;
+        }
+
+        const SSD1963_Glyph* g = SSD1963_FontGlyph(font, *text);
+        if (g) pen = font_draw_glyph(pen, y, font, g, *text, fg, bg, &left);
+    }
+    return pen;
+}
+
+int16_t SSD1963_TextWidth(const SSD1963_Font* font, const char* text)
+{
+    int32_t width = 0, line = 0;
+
+    for (; *text; text++)
+    {
+        if (*text == '\n')
+        {
+            line = 0;
+            continue;
+        }
+
+        const SSD1963_Glyph* g = SSD1963_FontGlyph(font, *text);
+        if (g) line += g->advance;
+        if (line > width) width = line;
+    }
+    return (int16_t)width;
+}
@@ -0,0 +1,107 @@
+#include "ssd1963_gfx.h"
+#include "ssd1963_bus.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Clip state
+// -----------------------------
+static SSD1963_Rect gfx_clip = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+
+static inline int16_t gfx_max(int16_t a, int16_t b) { return (a > b) ? a : b; }
+static inline int16_t gfx_min(int16_t a, int16_t b) { return (a < b) ? a : b; }
+
+void SSD1963_SetClip(const SSD1963_Rect* clip)
+{
+    gfx_clip.x0 = 0;
+    gfx_clip.y0 = 0;
+    gfx_clip.x1 = SSD_HOR_RESOLUTION - 1;
+    gfx_clip.y1 = SSD_VER_RESOLUTION - 1;
+
+    if (clip == NULL) return;
+
+    // Never let the clip escape the panel: the controller wraps out-of-range windows
+    gfx_clip.x0 = gfx_max(clip->x0, gfx_clip.x0);
+    gfx_clip.y0 = gfx_max(clip->y0, gfx_clip.y0);
+    gfx_clip.x1 = gfx_min(clip->x1, gfx_clip.x1);
+    gfx_clip.y1 = gfx_min(clip->y1, gfx_clip.y1);
+}
+
+void SSD1963_GetClip(SSD1963_Rect* clip)
+{
+    *clip = gfx_clip;
+}
+
+uint8_t SSD1963_ClipRect(const SSD1963_Rect* r, SSD1963_Rect* out)
+{
+    out->x0 = gfx_max(r->x0, gfx_clip.x0);
+    out->y0 = gfx_max(r->y0, gfx_clip.y0);
+    out->x1 = gfx_min(r->x1, gfx_clip.x1);
+    out->y1 = gfx_min(r->y1, gfx_clip.y1);
+
+    return (out->x0 <= out->x1) && (out->y0 <= out->y1);
+}
+
+// -----------------------------
+// Primitives
+// -----------------------------
+static void gfx_window(const SSD1963_Rect* r)
+{
+    SSD1963_SetWindow((uint16_t)r->x0, (uint16_t)r->y0, (uint16_t)r->x1, (uint16_t)r->y1);
+}
+
+static void gfx_fill_clipped(const SSD1963_Rect* r, uint16_t rgb565)
+{
+    SSD1963_Rect c;
+    if (!SSD1963_ClipRect(r, &c)) return;
+
+    gfx_window(&c);
+
+    lcd_dat_fill(rgb565, (uint32_t)(c.x1 - c.x0 + 1) * (uint32_t)(c.y1 - c.y0 + 1));
+}
+
+void SSD1963_FillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t rgb565)
+{
+    if (w <= 0 || h <= 0) return;
+
+    const SSD1963_Rect r = { x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+    gfx_fill_clipped(&r, rgb565);
+}
+
+void SSD1963_DrawHLine(int16_t x, int16_t y, int16_t w, uint16_t rgb565)
+{
+    SSD1963_FillRect(x, y, w, 1, rgb565);
+}
+
+void SSD1963_DrawVLine(int16_t x, int16_t y, int16_t h, uint16_t rgb565)
+{
+    SSD1963_FillRect(x, y, 1, h, rgb565);
+}
+
+void SSD1963_DrawPixel(int16_t x, int16_t y, uint16_t rgb565)
+{
+    if (x < gfx_clip.x0 || x > gfx_clip.x1 || y < gfx_clip.y0 || y > gfx_clip.y1) return;
+
+    SSD1963_SetWindow((uint16_t)x, (uint16_t)y, (uint16_t)x, (uint16_t)y);
+    lcd_dat(rgb565);
+}
+
+void SSD1963_Blit(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels)
+{
+    if (w <= 0 || h <= 0) return;
+
+    const SSD1963_Rect r = { x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+    SSD1963_Rect c;
+    if (!SSD1963_ClipRect(&r, &c)) return;
+
+    gfx_window(&c);
+
+    // Walk only the visible part of the source; the controller wraps rows inside the window
+    const uint16_t cols = (uint16_t)(c.x1 - c.x0 + 1);
+    const uint16_t* row = pixels + (int32_t)(c.y0 - y) * w + (c.x0 - x);
+    for (int16_t yy = c.y0; yy <= c.y1; yy++)
+    {
+        lcd_dat_copy(row, cols);
+        row += w;
+    }
+}
@@ -0,0 +1,150 @@
+#include "ssd1963_image.h"
+#include "ssd1963_gfx.h"
+#include "ssd1963_bus.h"
+
+#include <stddef.h>
+
+#define IMG_OP_RUN      0u
+#define IMG_OP_LITERAL  1u
+#define IMG_OP_FILL     2u
+#define IMG_OP_ABOVE    3u
+
+// Row the decoder is producing; until a column is overwritten it still holds the row above
+static uint16_t img_row[SSD_HOR_RESOLUTION];
+
+typedef struct
+{
+    const uint8_t* p;
+    const uint8_t* end;
+} ImgStream;
+
+static uint8_t img_byte(ImgStream* s, uint8_t* out)
+{
+    if (s->p >= s->end) return 0;
+    *out = *s->p++;
+    return 1;
+}
+
+static uint8_t img_colour(ImgStream* s, uint16_t* out)
+{
+    if (s->end - s->p < 2) return 0;
+    *out = (uint16_t)(s->p[0] | (s->p[1] << 8));
+    s->p += 2;
+    return 1;
+}
+
+static uint8_t img_count(ImgStream* s, uint8_t tag, uint32_t* out)
+{
+    *out = (tag & 0x3Fu) + 1u;
+    if (*out < 64u) return 1;
+
+    uint32_t v = 0;
+    for (uint32_t shift = 0; shift < 28u; shift += 7u)
+    {
+        uint8_t b;
+        if (!img_byte(s, &b)) return 0;
+        v |= (uint32_t)(b & 0x7Fu) << shift;
+        if (!(b & 0x80u))
+        {
+            *out = 64u + v;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+uint8_t SSD1963_DrawImage(int16_t x, int16_t y, const SSD1963_Image* img)
+{
+    if (img->width == 0 || img->height == 0 || img->width > SSD_HOR_RESOLUTION) return 0;
+
+    const SSD1963_Rect r = { x, y, (int16_t)(x + img->width - 1), (int16_t)(y + img->height - 1) };
+    SSD1963_Rect vis;
+    if (!SSD1963_ClipRect(&r, &vis)) return 1;
+
+    // Visible part in image coordinates
+    const uint32_t w = img->width;
+    const uint32_t vx0 = (uint32_t)(vis.x0 - x);
+    const uint32_t vx1 = (uint32_t)(vis.x1 - x);
+    const uint32_t vy0 = (uint32_t)(vis.y0 - y);
+    const uint32_t vy1 = (uint32_t)(vis.y1 - y);
+
+    SSD1963_SetWindow((uint16_t)vis.x0, (uint16_t)vis.y0, (uint16_t)vis.x1, (uint16_t)vis.y1);
+
+    for (uint32_t i = 0; i < w; i++) img_row[i] = 0;
+
+    ImgStream s = { img->data, img->data + img->size };
+    uint16_t last = 0;
+    uint32_t col = 0, row = 0;
+    uint8_t ok = 1;
+
+    // Rows below the window are never needed: stop as soon as the last visible one is out
+    while (row <= vy1)
+    {
+        uint8_t tag;
+        uint32_t count;
+        if (!img_byte(&s, &tag) || !img_count(&s, tag, &count))
+        {
+            ok = 0;
+            break;
+        }
+
+        const uint32_t op = tag >> 6;
+        if (op == IMG_OP_FILL && !img_colour(&s, &last))
+        {
+            ok = 0;
+            break;
+        }
+
+        // One row segment at a time, so visibility is decided per segment, not per pixel
+        while (count && row <= vy1)
+        {
+            const uint32_t seg = (count < w - col) ? count : w - col;
+            const uint32_t end = col + seg;
+            const uint8_t row_vis = (row >= vy0);
+
+            for (uint32_t c = col; c < end; c++)
+            {
+                if (op == IMG_OP_LITERAL)
+                {
+                    if (!img_colour(&s, &last))
+                    {
+                        ok = 0;
+                        col = c;
+                        break;
+                    }
+                }
+                else if (op == IMG_OP_ABOVE)
+                {
+                    last = img_row[c];
+                }
+                img_row[c] = last;
+                if (row_vis && c >= vx0 && c <= vx1) lcd_dat(last);
+            }
+            if (!ok) break;
+
+            count -= seg;
+            col = end;
+            if (col == w)
+            {
+                col = 0;
+                row++;
+            }
+        }
+        if (!ok) break;
+    }
+
+    // Keep the window's pixel count whole even for a short stream, so the next window
+    // does not start with leftovers of this one
+    if (row <= vy1)
+    {
+        ok = 0;
+        for (; row <= vy1; row++, col = 0)
+        {
+            if (row < vy0) continue;
+            for (uint32_t c = col; c < w; c++)
+                if (c >= vx0 && c <= vx1) lcd_dat(0);
+        }
+    }
+
+    return ok;
+}
@@ -0,0 +1,401 @@
+#include "ssd1963_shapes.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Trig
+// -----------------------------
+// Quarter sine in Q15 at 256 steps, evaluated by the compiler: the Taylor series to x^13
+// is exact to well below one LSB on [0, pi/2], and a floating constant expression cast
+// to an integer is a valid static initialiser, so no table has to be generated or pasted.
+#define SHAPE_PI            3.14159265358979323846
+#define SHAPE_X2(x)         ((x) * (x))
+#define SHAPE_SIN_POLY(x)   ((x) * (1.0 - SHAPE_X2(x) / 6.0 * (1.0 - SHAPE_X2(x) / 20.0 * \
+                            (1.0 - SHAPE_X2(x) / 42.0 * (1.0 - SHAPE_X2(x) / 72.0 * \
+                            (1.0 - SHAPE_X2(x) / 110.0 * (1.0 - SHAPE_X2(x) / 156.0)))))))
+#define SHAPE_SIN_Q15(i)    (int16_t)(SHAPE_SIN_POLY((i) * (SHAPE_PI / 2.0) / 256.0) * 32767.0 + 0.5)
+
+#define SHAPE_SIN1(i)       SHAPE_SIN_Q15(i),
+#define SHAPE_SIN4(i)       SHAPE_SIN1(i) SHAPE_SIN1((i) + 1) SHAPE_SIN1((i) + 2) SHAPE_SIN1((i) + 3)
+#define SHAPE_SIN16(i)      SHAPE_SIN4(i) SHAPE_SIN4((i) + 4) SHAPE_SIN4((i) + 8) SHAPE_SIN4((i) + 12)
+#define SHAPE_SIN64(i)      SHAPE_SIN16(i) SHAPE_SIN16((i) + 16) SHAPE_SIN16((i) + 32) SHAPE_SIN16((i) + 48)
+#define SHAPE_SIN256(i)     SHAPE_SIN64(i) SHAPE_SIN64((i) + 64) SHAPE_SIN64((i) + 128) SHAPE_SIN64((i) + 192)
+
+// One guard entry past 90 degrees keeps the interpolation branch-free
+static const int16_t shape_sin_lut[258] = { SHAPE_SIN256(0) SHAPE_SIN1(256) SHAPE_SIN1(256) };
+
+int16_t SSD1963_Sin(int32_t angle)
+{
+    const uint32_t a = (uint32_t)angle & 0xFFFFu;
+    uint32_t q = a & 0x3FFFu;
+    if (a & 0x4000u) q = 0x4000u - q;   // second and fourth quadrant run backwards
+
+    const uint32_t i = q >> 6;
+    const int32_t f = (int32_t)(q & 0x3Fu);
+    const int32_t v = shape_sin_lut[i] + (((shape_sin_lut[i + 1] - shape_sin_lut[i]) * f) >> 6);
+
+    return (int16_t)((a & 0x8000u) ? -v : v);
+}
+
+int16_t SSD1963_Cos(int32_t angle)
+{
+    return SSD1963_Sin(angle + SSD1963_ANGLE_TURN / 4);
+}
+
+// -----------------------------
+// Span batching
+// -----------------------------
+// Rectangles still growing downwards. A span extends a pending rectangle when it covers
+// exactly the same columns on the next row; rectangles the current row has moved past
+// can never grow again and are sent. Shapes add their spans in row order.
+#define SHAPE_PENDING   4
+
+typedef struct
+{
+    SSD1963_Rect pending[SHAPE_PENDING];
+    uint8_t count;
+    uint16_t colour;
+    SSD1963_Rect clip;
+} ShapeSpans;
+
+static void spans_begin(ShapeSpans* s, uint16_t colour)
+{
+    s->count = 0;
+    s->colour = colour;
+    SSD1963_GetClip(&s->clip);
+}
+
+static void spans_send(ShapeSpans* s, uint8_t i)
+{
+    const SSD1963_Rect* r = &s->pending[i];
+    SSD1963_FillRect(r->x0, r->y0, (int16_t)(r->x1 - r->x0 + 1), (int16_t)(r->y1 - r->y0 + 1), s->colour);
+    s->pending[i] = s->pending[--s->count];
+}
+
+static void spans_add(ShapeSpans* s, int32_t x0, int32_t x1, int32_t y)
+{
+    // Clip first, so merging sees the columns that are actually written
+    if (y < s->clip.y0 || y > s->clip.y1) return;
+    if (x0 < s->clip.x0) x0 = s->clip.x0;
+    if (x1 > s->clip.x1) x1 = s->clip.x1;
+    if (x0 > x1) return;
+
+    for (uint8_t i = 0; i < s->count; )
+    {
+        SSD1963_Rect* r = &s->pending[i];
+        if (r->y1 == y - 1 && r->x0 == x0 && r->x1 == x1)
+        {
+            r->y1 = (int16_t)y;
+            return;
+        }
+        if (r->y1 < y - 1)
+        {
+            spans_send(s, i);
+            continue;
+        }
+        i++;
+    }
+
+    if (s->count == SHAPE_PENDING) spans_send(s, 0);
+    s->pending[s->count++] = (SSD1963_Rect){ (int16_t)x0, (int16_t)y, (int16_t)x1, (int16_t)y };
+}
+
+static void spans_end(ShapeSpans* s)
+{
+    while (s->count) spans_send(s, (uint8_t)(s->count - 1u));
+}
+
+// -----------------------------
+// Lines and polygons
+// -----------------------------
+void SSD1963_DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t rgb565)
+{
+    if (y0 > y1)
+    {
+        int16_t t = x0; x0 = x1; x1 = t;
+        t = y0; y0 = y1; y1 = t;
+    }
+
+    const int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    const int32_t dy = -(int32_t)(y1 - y0);
+    const int32_t sx = (x0 < x1) ? 1 : -1;
+    int32_t err = dx + dy;
+    int32_t x = x0, y = y0;
+    int32_t row_a = x, row_b = x;     // pixels of the current row, in drawing order
+
+    ShapeSpans s;
+    spans_begin(&s, rgb565);
+
+    // Bresenham, collecting each row's pixels into one span
+    while (x != x1 || y != y1)
+    {
+        const int32_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            spans_add(&s, (row_a < row_b) ? row_a : row_b, (row_a < row_b) ? row_b : row_a, y);
+            y++;
+            row_a = x;
+        }
+        row_b = x;
+    }
+    spans_add(&s, (row_a < row_b) ? row_a : row_b, (row_a < row_b) ? row_b : row_a, y);
+
+    spans_end(&s);
+}
+
+// floor(a / b) for b > 0
+static int32_t shape_floor_div(int32_t a, int32_t b)
+{
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+void SSD1963_FillConvex(const SSD1963_Point* pts, uint8_t n, uint16_t rgb565)
+{
+    if (n == 0 || n > SSD1963_POLY_MAX) return;
+
+    int32_t top = pts[0].y, bottom = pts[0].y;
+    for (uint8_t i = 1; i < n; i++)
+    {
+        if (pts[i].y < top) top = pts[i].y;
+        if (pts[i].y > bottom) bottom = pts[i].y;
+    }
+
+    ShapeSpans s;
+    spans_begin(&s, rgb565);
+
+    if (top < s.clip.y0) top = s.clip.y0;
+    if (bottom > s.clip.y1) bottom = s.clip.y1;
+
+    for (int32_t y = top; y <= bottom; y++)
+    {
+        int32_t left = INT32_MAX, right = INT32_MIN;
+
+        // Every edge crossing this row, rounded to the nearest pixel centre
+        for (uint8_t i = 0; i < n; i++)
+        {
+            const SSD1963_Point* a = &pts[i];
+            const SSD1963_Point* b = &pts[(i + 1u) % n];
+            int32_t xa, xb;
+
+            if (a->y == b->y)
+            {
+                if (a->y != y) continue;
+                xa = a->x;
+                xb = b->x;
+            }
+            else
+            {
+                const SSD1963_Point* lo = (a->y < b->y) ? a : b;
+                const SSD1963_Point* hi = (a->y < b->y) ? b : a;
+                if (y < lo->y || y > hi->y) continue;
+
+                const int32_t den = hi->y - lo->y;
+                const int32_t num = (y - lo->y) * (hi->x - lo->x);
+                xa = xb = lo->x + shape_floor_div(2 * num + den, 2 * den);
+            }
+
+            if (xa < left) left = xa;
+            if (xb < left) left = xb;
+            if (xa > right) right = xa;
+            if (xb > right) right = xb;
+        }
+
+        if (left <= right) spans_add(&s, left, right, y);
+    }
+
+    spans_end(&s);
+}
+
+// Integer square root, floor
+static uint32_t shape_isqrt(uint32_t v)
+{
+    uint32_t r = 0;
+    for (uint32_t bit = 1u << 30; bit; bit >>= 2)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+        {
+            r >>= 1;
+        }
+    }
+    return r;
+}
+
+void SSD1963_DrawThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+                           uint16_t rgb565)
+{
+    if (width <= 1)
+    {
+        SSD1963_DrawLine(x0, y0, x1, y1, rgb565);
+        return;
+    }
+
+    const int32_t dx = x1 - x0;
+    const int32_t dy = y1 - y0;
+    const int32_t len = (int32_t)shape_isqrt((uint32_t)(dx * dx + dy * dy));
+    const int32_t half = width - 1;   // doubled half width, rounded below
+
+    if (len == 0)
+    {
+        SSD1963_FillRect((int16_t)(x0 - half / 2), (int16_t)(y0 - half / 2), width, width, rgb565);
+        return;
+    }
+
+    // Perpendicular of half the width, rounded to the nearest pixel
+    const int32_t ox = shape_floor_div(-dy * half + len, 2 * len);
+    const int32_t oy = shape_floor_div(dx * half + len, 2 * len);
+
+    const SSD1963_Point quad[4] = {
+        { (int16_t)(x0 + ox), (int16_t)(y0 + oy) },
+        { (int16_t)(x1 + ox), (int16_t)(y1 + oy) },
+        { (int16_t)(x1 - ox), (int16_t)(y1 - oy) },
+        { (int16_t)(x0 - ox), (int16_t)(y0 - oy) },
+    };
+    SSD1963_FillConvex(quad, 4, rgb565);
+}
+
+// -----------------------------
+// Circles and arcs
+// -----------------------------
+// Sector of at most half a turn between the rays d0 and d1 (Q15 unit vectors): p is
+// inside when cross(d0, p) >= 0 and cross(p, d1) >= 0.
+typedef struct
+{
+    int32_t d0x, d0y;
+    int32_t d1x, d1y;
+} ShapeSector;
+
+// Narrow [*lo, *hi] to the x with k * x + m >= 0
+static void shape_half_plane(int32_t k, int32_t m, int32_t* lo, int32_t* hi)
+{
+    if (k > 0)
+    {
+        const int32_t bound = -shape_floor_div(m, k);   // ceil(-m / k)
+        if (bound > *lo) *lo = bound;
+    }
+    else if (k < 0)
+    {
+        const int32_t bound = shape_floor_div(m, -k);
+        if (bound < *hi) *hi = bound;
+    }
+    else if (m < 0)
+    {
+        *hi = *lo - 1;
+    }
+}
+
+static void shape_segment(ShapeSpans* s, const ShapeSector* sec, int32_t cx, int32_t cy,
+                          int32_t x0, int32_t x1, int32_t y)
+{
+    if (sec)
+    {
+        shape_half_plane(-sec->d0y, sec->d0x * y, &x0, &x1);
+        shape_half_plane(sec->d1y, -sec->d1x * y, &x0, &x1);
+    }
+    if (x0 <= x1) spans_add(s, cx + x0, cx + x1, cy + y);
+}
+
+// Midpoint step: move *x to the largest value with x^2 + y^2 <= lim. Rows are visited
+// top to bottom, so x only ever walks a few pixels per row. -1 if the row is empty.
+static int32_t shape_row_extent(int32_t* x, int32_t lim, int32_t y)
+{
+    const int32_t y2 = y * y;
+    if (y2 > lim) return -1;
+
+    if (*x < 0) *x = 0;
+    while ((*x + 1) * (*x + 1) + y2 <= lim) (*x)++;
+    while ((*x) * (*x) + y2 > lim) (*x)--;
+    return *x;
+}
+
+// Pixels with (ri + 1/2)^2 < x^2 + y^2 <= (ro + 1/2)^2 around (cx, cy); ri < 0 fills
+static void shape_ring(int32_t cx, int32_t cy, int32_t ro, int32_t ri, const ShapeSector* sec,
+                       uint16_t rgb565)
+{
+    if (ro < 0) return;
+
+    const int32_t lim_o = ro * ro + ro;
+    const int32_t lim_i = (ri >= 0) ? ri * ri + ri : -1;
+    int32_t xo = 0, xi = 0;
+
+    ShapeSpans s;
+    spans_begin(&s, rgb565);
+
+    int32_t y0 = -ro, y1 = ro;
+    if (cy + y0 < s.clip.y0) y0 = s.clip.y0 - cy;
+    if (cy + y1 > s.clip.y1) y1 = s.clip.y1 - cy;
+
+    for (int32_t y = y0; y <= y1; y++)
+    {
+        const int32_t a = shape_row_extent(&xo, lim_o, y);
+        if (a < 0) continue;
+
+        const int32_t b = (lim_i >= 0) ? shape_row_extent(&xi, lim_i, y) : -1;
+        if (b < 0)
+        {
+            shape_segment(&s, sec, cx, cy, -a, a, y);
+        }
+        else
+        {
+            shape_segment(&s, sec, cx, cy, -a, -b - 1, y);
+            shape_segment(&s, sec, cx, cy, b + 1, a, y);
+        }
+    }
+
+    spans_end(&s);
+}
+
+void SSD1963_DrawCircle(int16_t cx, int16_t cy, int16_t r, uint16_t rgb565)
+{
+    shape_ring(cx, cy, r, r - 1, NULL, rgb565);
+}
+
+void SSD1963_FillCircle(int16_t cx, int16_t cy, int16_t r, uint16_t rgb565)
+{
+    shape_ring(cx, cy, r, -1, NULL, rgb565);
+}
+
+static void shape_sector(ShapeSector* sec, int32_t start, int32_t sweep)
+{
+    sec->d0x = SSD1963_Cos(start);
+    sec->d0y = SSD1963_Sin(start);
+    sec->d1x = SSD1963_Cos(start + sweep);
+    sec->d1y = SSD1963_Sin(start + sweep);
+}
+
+void SSD1963_DrawArc(int16_t cx, int16_t cy, int16_t r, int16_t thickness,
+                     int32_t start, int32_t sweep, uint16_t rgb565)
+{
+    if (thickness <= 0 || sweep <= 0) return;
+
+    const int32_t ri = (r - thickness >= 0) ? r - thickness : -1;
+
+    if (sweep >= SSD1963_ANGLE_TURN)
+    {
+        shape_ring(cx, cy, r, ri, NULL, rgb565);
+        return;
+    }
+
+    // The half-plane test only describes sectors up to half a turn
+    ShapeSector sec;
+    if (sweep > SSD1963_ANGLE_TURN / 2)
+    {
+        const int32_t half = sweep / 2;
+        shape_sector(&sec, start, half);
+        shape_ring(cx, cy, r, ri, &sec, rgb565);
+        start += half;
+        sweep -= half;
+    }
+    shape_sector(&sec, start, sweep);
+    shape_ring(cx, cy, r, ri, &sec, rgb565);
+}
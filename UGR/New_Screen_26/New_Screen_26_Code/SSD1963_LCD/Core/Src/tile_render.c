@@ -0,0 +1,250 @@
+#include "tile_render.h"
+#include "blit2d.h"
+#include "blend565.h"
+#include "memory_map.h"
+#include "perf.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Strip buffers
+// -----------------------------
+// Non-cacheable, so DMA2 sees exactly what the CPU wrote without a clean per strip
+static uint16_t tile_buf[2][TILE_WIDTH * TILE_ROWS] MEM_DMA_BUFFER;
+
+_Static_assert(sizeof(tile_buf) + MEM_CACHE_LINE <= MEM_DMA_WINDOW_SIZE,
+               "strip buffers and the fill colour must share the DMA window");
+
+// Buffer the next strip is drawn into. Kept across calls: the last strip of one render
+// may still be going out when the next render starts.
+static uint8_t tile_next;
+
+static TILE_Stats tile_stats;
+
+void TILE_Render(const SSD1963_Rect* area, TILE_RenderFn render)
+{
+    SSD1963_Rect a;
+    if (!SSD1963_ClipRect(area, &a)) return;
+
+    const uint16_t width = (uint16_t)(a.x1 - a.x0 + 1);
+
+    for (int32_t y = a.y0; y <= a.y1; y += TILE_ROWS)
+    {
+        // This buffer last went out two strips ago, and that transfer completed before
+        // the previous strip was started, so it is free to draw into
+        TILE_Target t;
+        t.pixels = tile_buf[tile_next];
+        t.stride = width;
+        t.area.x0 = a.x0;
+        t.area.x1 = a.x1;
+        t.area.y0 = (int16_t)y;
+        t.area.y1 = (int16_t)((y + TILE_ROWS - 1 < a.y1) ? y + TILE_ROWS - 1 : a.y1);
+
+        const uint32_t t0 = PERF_Cycles();
+        render(&t);
+        BLIT_Wait();
+        const uint32_t t1 = PERF_Cycles();
+        SSD1963_WaitIdle();
+        const uint32_t t2 = PERF_Cycles();
+
+        SSD1963_BlitAsync((uint16_t)t.area.x0, (uint16_t)t.area.y0, (uint16_t)t.area.x1, (uint16_t)t.area.y1,
+                          t.pixels, NULL);
+
+        tile_stats.strips++;
+        tile_stats.render_cycles += t1 - t0;
+        tile_stats.wait_cycles += t2 - t1;
+        tile_next ^= 1u;
+    }
+}
+
+void TILE_GetStats(TILE_Stats* out)
+{
+    *out = tile_stats;
+}
+
+void TILE_ResetStats(void)
+{
+    tile_stats = (TILE_Stats){ 0 };
+}
+
+// -----------------------------
+// Drawing into a strip
+// -----------------------------
+static uint8_t tile_clip(const TILE_Target* t, const SSD1963_Rect* r, SSD1963_Rect* out)
+{
+    out->x0 = (r->x0 > t->area.x0) ? r->x0 : t->area.x0;
+    out->y0 = (r->y0 > t->area.y0) ? r->y0 : t->area.y0;
+    out->x1 = (r->x1 < t->area.x1) ? r->x1 : t->area.x1;
+    out->y1 = (r->y1 < t->area.y1) ? r->y1 : t->area.y1;
+    return (out->x0 <= out->x1) && (out->y0 <= out->y1);
+}
+
+static inline uint16_t* tile_at(const TILE_Target* t, int32_t x, int32_t y)
+{
+    return &t->pixels[(y - t->area.y0) * t->stride + (x - t->area.x0)];
+}
+
+void TILE_Fill(const TILE_Target* t, const SSD1963_Rect* r, uint16_t rgb565)
+{
+    SSD1963_Rect c;
+    if (!tile_clip(t, r, &c)) return;
+
+    BLIT_Fill(tile_at(t, c.x0, c.y0), t->stride, (uint16_t)(c.x1 - c.x0 + 1), (uint16_t)(c.y1 - c.y0 + 1),
+              rgb565);
+}
+
+void TILE_FillAlpha(const TILE_Target* t, const SSD1963_Rect* r, uint16_t rgb565, uint8_t alpha)
+{
+    SSD1963_Rect c;
+    if (alpha == 0 || !tile_clip(t, r, &c)) return;
+    if (alpha == 255)
+    {
+        TILE_Fill(t, &c, rgb565);
+        return;
+    }
+
+    // The blends below touch the strip directly, after any DMA2D operation on it
+    BLIT_Wait();
+    for (int32_t y = c.y0; y <= c.y1; y++) BLEND_Colour(tile_at(t, c.x0, y), rgb565, alpha, (uint32_t)(c.x1 - c.x0 + 1));
+}
+
+void TILE_FillGradient(const TILE_Target* t, const SSD1963_Rect* r, uint16_t top, uint16_t bottom)
+{
+    SSD1963_Rect c;
+    if (!tile_clip(t, r, &c)) return;
+
+    const int32_t span = (r->y1 > r->y0) ? r->y1 - r->y0 : 1;
+    const int32_t r0 = top >> 11, g0 = (top >> 5) & 0x3F, b0 = top & 0x1F;
+    const int32_t r1 = bottom >> 11, g1 = (bottom >> 5) & 0x3F, b1 = bottom & 0x1F;
+
+    BLIT_Wait();
+    for (int32_t y = c.y0; y <= c.y1; y++)
+    {
+        const int32_t k = y - r->y0;
+        const uint16_t colour = (uint16_t)(((r0 + (r1 - r0) * k / span) << 11) |
+                                           ((g0 + (g1 - g0) * k / span) << 5) |
+                                           (b0 + (b1 - b0) * k / span));
+        uint16_t* p = tile_at(t, c.x0, y);
+        for (int32_t x = c.x0; x <= c.x1; x++) *p++ = colour;
+    }
+}
+
+// Clip a w x h image placed at (x, y): the visible part c, and the offset of its first
+// pixel in the image
+static uint8_t tile_clip_image(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h,
+                               SSD1963_Rect* c, uint32_t* offset)
+{
+    if (w <= 0 || h <= 0) return 0;
+
+    const SSD1963_Rect r = { x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+    if (!tile_clip(t, &r, c)) return 0;
+
+    *offset = (uint32_t)((c->y0 - y) * w + (c->x0 - x));
+    return 1;
+}
+
+void TILE_Blit(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_Copy(tile_at(t, c.x0, c.y0), t->stride, pixels + offset, (uint16_t)w,
+              (uint16_t)(c.x1 - c.x0 + 1), (uint16_t)(c.y1 - c.y0 + 1));
+}
+
+void TILE_BlendArgb8888(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint32_t* pixels)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_BlendArgb8888(tile_at(t, c.x0, c.y0), t->stride, pixels + offset, (uint16_t)w,
+                       (uint16_t)(c.x1 - c.x0 + 1), (uint16_t)(c.y1 - c.y0 + 1));
+}
+
+void TILE_BlendArgb4444(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h,
+                        const uint16_t* pixels)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_BlendArgb4444(tile_at(t, c.x0, c.y0), t->stride, pixels + offset, (uint16_t)w,
+                       (uint16_t)(c.x1 - c.x0 + 1), (uint16_t)(c.y1 - c.y0 + 1));
+}
+
+void TILE_BlitL8(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t* indices,
+                 const uint32_t* clut, uint16_t clut_size)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_ExpandL8(tile_at(t, c.x0, c.y0), t->stride, indices + offset, (uint16_t)w,
+                  (uint16_t)(c.x1 - c.x0 + 1), (uint16_t)(c.y1 - c.y0 + 1), clut, clut_size);
+}
+
+void TILE_BlendA8(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels,
+                  const uint8_t* alpha)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_Wait();
+    for (int32_t yy = c.y0; yy <= c.y1; yy++, offset += (uint32_t)w)
+        BLEND_ImageA8(tile_at(t, c.x0, yy), pixels + offset, alpha + offset, (uint32_t)(c.x1 - c.x0 + 1));
+}
+
+void TILE_BlendA4(const TILE_Target* t, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels,
+                  const uint8_t* alpha4)
+{
+    SSD1963_Rect c;
+    uint32_t offset;
+    if (!tile_clip_image(t, x, y, w, h, &c, &offset)) return;
+
+    BLIT_Wait();
+    for (int32_t yy = c.y0; yy <= c.y1; yy++, offset += (uint32_t)w)
+        BLEND_ImageA4(tile_at(t, c.x0, yy), pixels + offset, alpha4, offset, (uint32_t)(c.x1 - c.x0 + 1));
+}
+
+int16_t TILE_DrawText(const TILE_Target* t, int16_t x, int16_t y, const SSD1963_Font* font,
+                      const char* text, uint16_t fg)
+{
+    uint8_t coverage[255];
+    int16_t pen = x;
+
+    BLIT_Wait();
+    for (; *text; text++)
+    {
+        if (*text == '\n')
+        {
+            y = (int16_t)(y + font->line_height);
+            pen = x;
+            continue;
+        }
+
+        const SSD1963_Glyph* g = SSD1963_FontGlyph(font, *text);
+        if (g == NULL) continue;
+
+        const int32_t gx = pen + g->x_off;
+        const int32_t gy = y + font->ascent + g->y_off;
+        pen = (int16_t)(pen + g->advance);
+
+        // Only the rows of the glyph that fall into this strip
+        int32_t y0 = (gy > t->area.y0) ? gy : t->area.y0;
+        int32_t y1 = (gy + g->height - 1 < t->area.y1) ? gy + g->height - 1 : t->area.y1;
+        int32_t x0 = (gx > t->area.x0) ? gx : t->area.x0;
+        int32_t x1 = (gx + g->width - 1 < t->area.x1) ? gx + g->width - 1 : t->area.x1;
+        if (g->width == 0 || y0 > y1 || x0 > x1) continue;
+
+        for (int32_t yy = y0; yy <= y1; yy++)
+        {
+            SSD1963_GlyphCoverage(font, g, (uint32_t)(yy - gy), coverage);
+            BLEND_ColourA8(tile_at(t, x0, yy), fg, &coverage[x0 - gx], (uint32_t)(x1 - x0 + 1));
+        }
+    }
+    return pen;
+}
@@ -0,0 +1,105 @@
+#include "ui_chart.h"
+#include "ssd1963.h"
+#include "ssd1963_gfx.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Chart state
+// -----------------------------
+static const UI_Chart* ui_chart;
+static int16_t ui_chart_line;           // frame memory line at the top of the band
+static int16_t ui_chart_x0, ui_chart_x1;   // lane columns on the panel
+static int16_t ui_chart_rows;           // band height inside the panel
+static uint16_t ui_chart_samples;
+static int16_t ui_chart_prev[UI_CHART_MAX_TRACES];
+static uint16_t ui_chart_row[SSD_HOR_RESOLUTION];
+
+static int16_t ui_chart_x(const UI_ChartTrace* t, int32_t v)
+{
+    if (v <= t->min) return t->x0;
+    if (v >= t->max) return t->x1;
+    return (int16_t)(t->x0 + (int32_t)(((int64_t)(v - t->min) * (t->x1 - t->x0)) / (t->max - t->min)));
+}
+
+// Lanes laid out for a wider panel profile are cut at the panel edge
+static inline void ui_chart_put(uint16_t* row, int32_t x, uint16_t colour)
+{
+    if (x >= ui_chart_x0 && x <= ui_chart_x1) row[x - ui_chart_x0] = colour;
+}
+
+void UI_ChartStart(const UI_Chart* chart)
+{
+    ui_chart = chart;
+    ui_chart_samples = 0;
+
+    // Only the columns the lanes cover are ever rewritten
+    ui_chart_x0 = SSD_HOR_RESOLUTION - 1;
+    ui_chart_x1 = 0;
+    for (uint32_t i = 0; i < chart->traces; i++)
+    {
+        if (chart->trace[i].x0 < ui_chart_x0) ui_chart_x0 = chart->trace[i].x0;
+        if (chart->trace[i].x1 > ui_chart_x1) ui_chart_x1 = chart->trace[i].x1;
+    }
+    if (ui_chart_x0 < 0) ui_chart_x0 = 0;
+    if (ui_chart_x1 > SSD_HOR_RESOLUTION - 1) ui_chart_x1 = SSD_HOR_RESOLUTION - 1;
+
+    ui_chart_rows = chart->rows;
+    if (ui_chart_rows > SSD_VER_RESOLUTION - chart->y0) ui_chart_rows = (int16_t)(SSD_VER_RESOLUTION - chart->y0);
+    if (ui_chart_rows <= 0)
+    {
+        ui_chart = NULL;
+        return;
+    }
+
+    SSD1963_SetScrollArea((uint16_t)chart->y0, (uint16_t)ui_chart_rows,
+                          (uint16_t)(SSD_VER_RESOLUTION - chart->y0 - ui_chart_rows));
+    SSD1963_FillRect(0, chart->y0, SSD_HOR_RESOLUTION, ui_chart_rows, chart->bg);
+
+    ui_chart_line = chart->y0;
+    SSD1963_SetScrollStart((uint16_t)ui_chart_line);
+}
+
+void UI_ChartPush(const int32_t* samples)
+{
+    const UI_Chart* c = ui_chart;
+    if (c == NULL || ui_chart_x0 > ui_chart_x1) return;
+
+    const int32_t w = ui_chart_x1 - ui_chart_x0 + 1;
+    uint16_t* row = ui_chart_row;           // row[x - ui_chart_x0] for panel column x
+    const uint8_t tick = c->grid_every && (ui_chart_samples % c->grid_every) == 0;
+
+    for (int32_t x = 0; x < w; x++) row[x] = tick ? c->grid : c->bg;
+
+    for (uint32_t i = 0; i < c->traces; i++)
+    {
+        const UI_ChartTrace* t = &c->trace[i];
+        ui_chart_put(row, t->x0, c->grid);
+        ui_chart_put(row, t->x1, c->grid);
+
+        // Join the previous sample horizontally, so steep changes stay one connected trace
+        const int16_t x = ui_chart_x(t, samples[i]);
+        const int16_t prev = ui_chart_samples ? ui_chart_prev[i] : x;
+        const int16_t a = (prev < x) ? prev : x;
+        const int16_t b = (prev < x) ? x : prev;
+        for (int32_t xx = a; xx <= b; xx++) ui_chart_put(row, xx, t->colour);
+        ui_chart_prev[i] = x;
+    }
+
+    // The line above the current top, wrapping inside the band, becomes the new top once
+    // it holds the whole row
+    ui_chart_line = (ui_chart_line == c->y0) ? (int16_t)(c->y0 + ui_chart_rows - 1) : (int16_t)(ui_chart_line - 1);
+    SSD1963_Blit(ui_chart_x0, ui_chart_line, (int16_t)w, 1, row);
+    SSD1963_SetScrollStart((uint16_t)ui_chart_line);
+
+    ui_chart_samples++;
+}
+
+void UI_ChartStop(void)
+{
+    if (ui_chart == NULL) return;
+
+    SSD1963_SetScrollArea(0, SSD_VER_RESOLUTION, 0);
+    SSD1963_SetScrollStart(0);
+    ui_chart = NULL;
+}
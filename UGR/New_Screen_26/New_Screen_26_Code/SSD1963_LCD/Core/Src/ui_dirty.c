@@ -0,0 +1,143 @@
+#include "ui_dirty.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Dirty region list
+// -----------------------------
+// Regions are kept as merged rectangles. Two regions are combined when repainting their
+// bounding box costs no more bus writes than repainting both separately, i.e. when the
+// extra pixels the box drags in are paid for by the window setup that merging saves.
+static SSD1963_Rect ui_dirty[UI_DIRTY_MAX];
+static uint8_t ui_dirty_count;
+
+static inline int16_t ui_max(int16_t a, int16_t b) { return (a > b) ? a : b; }
+static inline int16_t ui_min(int16_t a, int16_t b) { return (a < b) ? a : b; }
+
+static uint32_t ui_area(const SSD1963_Rect* r)
+{
+    return (uint32_t)(r->x1 - r->x0 + 1) * (uint32_t)(r->y1 - r->y0 + 1);
+}
+
+static SSD1963_Rect ui_union(const SSD1963_Rect* a, const SSD1963_Rect* b)
+{
+    SSD1963_Rect u = {
+        ui_min(a->x0, b->x0), ui_min(a->y0, b->y0),
+        ui_max(a->x1, b->x1), ui_max(a->y1, b->y1)
+    };
+    return u;
+}
+
+static uint8_t ui_contains(const SSD1963_Rect* outer, const SSD1963_Rect* inner)
+{
+    return outer->x0 <= inner->x0 && outer->y0 <= inner->y0 &&
+           outer->x1 >= inner->x1 && outer->y1 >= inner->y1;
+}
+
+// Extra bus writes caused by painting the union instead of a and b separately
+// (negative when merging is a win). Overlap is counted twice when painted separately.
+static int32_t ui_merge_penalty(const SSD1963_Rect* a, const SSD1963_Rect* b)
+{
+    const SSD1963_Rect u = ui_union(a, b);
+    return (int32_t)ui_area(&u) - (int32_t)ui_area(a) - (int32_t)ui_area(b) - SSD1963_WINDOW_WRITES;
+}
+
+static void ui_remove(uint8_t i)
+{
+    ui_dirty[i] = ui_dirty[--ui_dirty_count];
+}
+
+// Fold r into the list, re-merging whatever the grown rectangle now pays for
+static void ui_insert(SSD1963_Rect r)
+{
+    uint8_t merged;
+    do
+    {
+        merged = 0;
+        for (uint8_t i = 0; i < ui_dirty_count; i++)
+        {
+            if (ui_merge_penalty(&ui_dirty[i], &r) <= 0)
+            {
+                r = ui_union(&ui_dirty[i], &r);
+                ui_remove(i);
+                merged = 1;
+                break;
+            }
+        }
+    } while (merged);
+
+    if (ui_dirty_count < UI_DIRTY_MAX)
+    {
+        ui_dirty[ui_dirty_count++] = r;
+        return;
+    }
+
+    // List full: merge r with whichever region it costs the least to absorb
+    uint8_t best = 0;
+    int32_t best_penalty = INT32_MAX;
+    for (uint8_t i = 0; i < ui_dirty_count; i++)
+    {
+        const int32_t p = ui_merge_penalty(&ui_dirty[i], &r);
+        if (p < best_penalty) { best_penalty = p; best = i; }
+    }
+    r = ui_union(&ui_dirty[best], &r);
+    ui_remove(best);
+    ui_insert(r);
+}
+
+void UI_Invalidate(const SSD1963_Rect* r)
+{
+    const SSD1963_Rect panel = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+    SSD1963_Rect c = {
+        ui_max(r->x0, panel.x0), ui_max(r->y0, panel.y0),
+        ui_min(r->x1, panel.x1), ui_min(r->y1, panel.y1)
+    };
+    if (c.x0 > c.x1 || c.y0 > c.y1) return;
+
+    for (uint8_t i = 0; i < ui_dirty_count; i++)
+    {
+        if (ui_contains(&ui_dirty[i], &c)) return;
+    }
+
+    ui_insert(c);
+}
+
+void UI_InvalidateAll(void)
+{
+    ui_dirty[0].x0 = 0;
+    ui_dirty[0].y0 = 0;
+    ui_dirty[0].x1 = SSD_HOR_RESOLUTION - 1;
+    ui_dirty[0].y1 = SSD_VER_RESOLUTION - 1;
+    ui_dirty_count = 1;
+}
+
+uint8_t UI_IsDirty(void)
+{
+    return ui_dirty_count != 0;
+}
+
+uint8_t UI_Flush(UI_RedrawFn redraw)
+{
+    // Take the list first: whatever redraw invalidates lands in the next frame
+    SSD1963_Rect regions[UI_DIRTY_MAX];
+    const uint8_t n = UI_TakeDirty(regions);
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        SSD1963_SetClip(&regions[i]);
+        redraw(&regions[i]);
+    }
+
+    SSD1963_SetClip(NULL);
+    return n;
+}
+
+uint8_t UI_TakeDirty(SSD1963_Rect* out)
+{
+    const uint8_t n = ui_dirty_count;
+
+    for (uint8_t i = 0; i < n; i++) out[i] = ui_dirty[i];
+
+    ui_dirty_count = 0;
+    return n;
+}
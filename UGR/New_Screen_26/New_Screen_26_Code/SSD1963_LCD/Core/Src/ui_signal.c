@@ -0,0 +1,115 @@
+#include "ui_signal.h"
+#include "ui_dirty.h"
+
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(UI_SIGNAL_MAX_WIDGETS <= 32u, "changed widgets are a 32-bit mask");
+
+// -----------------------------
+// Adjacency
+// -----------------------------
+// Signal s's subscriptions are ui_signal_subs[ui_signal_first[s] .. ui_signal_first[s + 1] - 1]
+typedef struct
+{
+    float   deadband;
+    float   last;           // value the widget was last invalidated for
+    uint8_t widget;
+} ui_SignalEntry;
+
+static uint16_t ui_signal_first[CANDB_SIGNAL_COUNT + 1];
+static ui_SignalEntry ui_signal_subs[UI_SIGNAL_MAX_SUBS];
+static const SSD1963_Rect* ui_signal_widgets;
+static uint32_t ui_signal_changed;
+static UI_SignalStats ui_signal_stats;
+
+uint8_t UI_SignalBind(const SSD1963_Rect* widgets, uint8_t nwidgets, const UI_SignalSub* subs, uint32_t nsubs)
+{
+    memset(ui_signal_first, 0, sizeof(ui_signal_first));
+    ui_signal_widgets = NULL;
+    ui_signal_changed = 0;
+
+    if (nwidgets > UI_SIGNAL_MAX_WIDGETS || nsubs > UI_SIGNAL_MAX_SUBS) return 0;
+    for (uint32_t i = 0; i < nsubs; i++)
+        if (subs[i].widget >= nwidgets || (uint32_t)subs[i].signal >= CANDB_SIGNAL_COUNT) return 0;
+
+    // Counting sort by signal: counts, then run starts, then placement (stable, so a
+    // signal's subscriptions keep their table order)
+    for (uint32_t i = 0; i < nsubs; i++) ui_signal_first[subs[i].signal + 1]++;
+    for (uint32_t s = 0; s < CANDB_SIGNAL_COUNT; s++) ui_signal_first[s + 1] += ui_signal_first[s];
+
+    uint16_t fill[CANDB_SIGNAL_COUNT];
+    memcpy(fill, ui_signal_first, sizeof(fill));
+    for (uint32_t i = 0; i < nsubs; i++)
+    {
+        ui_SignalEntry* e = &ui_signal_subs[fill[subs[i].signal]++];
+        e->deadband = subs[i].deadband;
+        e->last = cansig_store.value[subs[i].signal];
+        e->widget = subs[i].widget;
+    }
+
+    // Messages decoded before the binding are already reflected in last
+    memset(cansig_store.updated, 0, sizeof(cansig_store.updated));
+    ui_signal_widgets = widgets;
+    return 1;
+}
+
+// -----------------------------
+// Publish
+// -----------------------------
+uint32_t UI_SignalPublish(void)
+{
+    uint32_t hit = 0;
+
+    for (uint32_t w = 0; w < CANSIG_UPDATED_WORDS; w++)
+    {
+        uint32_t bits = cansig_store.updated[w];
+        cansig_store.updated[w] = 0;
+        if (ui_signal_widgets == NULL) continue;
+
+        for (; bits; bits &= bits - 1u)
+        {
+            const CANSIG_Message* m = &cansig_messages[w * 32u + (uint32_t)__builtin_ctz(bits)];
+            ui_signal_stats.messages++;
+
+            // The message's signals are one run, and so are their subscriptions
+            const uint32_t end = ui_signal_first[m->first + m->count];
+            uint32_t k = ui_signal_first[m->first];
+            for (uint32_t s = m->first; k < end; s++)
+            {
+                const float v = cansig_store.value[s];
+                for (; k < ui_signal_first[s + 1u]; k++)
+                {
+                    ui_SignalEntry* e = &ui_signal_subs[k];
+                    const float d = v - e->last;
+                    ui_signal_stats.checks++;
+                    if (d > e->deadband || d < -e->deadband)
+                    {
+                        e->last = v;
+                        hit |= 1u << e->widget;
+                        ui_signal_stats.changes++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Each widget once, however many of its signals moved
+    ui_signal_changed |= hit;
+    const uint32_t n = (uint32_t)__builtin_popcount(hit);
+    for (; hit; hit &= hit - 1u) UI_Invalidate(&ui_signal_widgets[__builtin_ctz(hit)]);
+    ui_signal_stats.invalidated += n;
+    return n;
+}
+
+uint32_t UI_SignalTakeChanged(void)
+{
+    const uint32_t changed = ui_signal_changed;
+    ui_signal_changed = 0;
+    return changed;
+}
+
+void UI_SignalGetStats(UI_SignalStats* stats)
+{
+    *stats = ui_signal_stats;
+}
@@ -0,0 +1,307 @@
+#include "ui_vsync.h"
+#include "ssd1963.h"
+#include "perf.h"
+#include "main.h"
+
+#include <stddef.h>
+
+// -----------------------------
+// Scan model
+// -----------------------------
+// The scan moves down one panel row per line_ns. A band written top to bottom at row_ns
+// per row tears only if the scan crosses the write pointer while both are inside the
+// band. With d = scanlines the scan is below the band's top row when writing starts:
+//   - write slower than the scan (row_ns > line_ns): the scan wraps, comes back in at
+//     the top and catches up; safe if h * (row_ns - line_ns) <= line_ns * (lines - d)
+//   - write faster than the scan: the pointer catches the scan from behind;
+//     safe if h * (line_ns - row_ns) <= line_ns * d
+// Starting just behind the scan is the sweet spot for the slow FMC writes of this board.
+static SSD1963_ScanTiming ui_scan;
+static UI_FrameHook ui_frame_hook;
+static uint16_t ui_last_line;
+
+// Time one redrawn pixel costs. Seeded with a single FMC write and then learned from
+// the scanlines each band actually took, which folds in the widgets' overdraw.
+static uint32_t ui_px_ns;
+static uint32_t ui_min_px_ns;
+
+static UI_VsyncStats ui_stats;
+
+static SSD1963_Rect ui_jobs[UI_VSYNC_MAX_JOBS];
+static uint8_t ui_job_count;
+
+void UI_VsyncInit(void)
+{
+    PERF_BusTiming t;
+
+    SSD1963_GetScanTiming(&ui_scan);
+    PERF_GetBusTiming(&t);
+    ui_min_px_ns = PERF_BusWriteNs(&t);
+    if (ui_px_ns < ui_min_px_ns) ui_px_ns = ui_min_px_ns;
+
+    // TE is not wired to the MCU yet, but keep it pulsing at the frame start so a
+    // board revision can switch to an EXTI without touching the panel setup
+    SSD1963_SetTearScanline(0);
+    SSD1963_SetTearOn(SSD1963_TEAR_VBLANK);
+
+    ui_last_line = SSD1963_GetScanline();
+}
+
+void UI_SetFrameBeginHook(UI_FrameHook hook)
+{
+    ui_frame_hook = hook;
+}
+
+// Every scanline read goes through here so frame starts are noticed during a flush too
+static uint8_t ui_read_line(uint16_t* line)
+{
+    uint16_t l = SSD1963_GetScanline();
+    if (l >= ui_scan.lines) l = (uint16_t)(l % ui_scan.lines);
+
+    const uint8_t wrapped = (l < ui_last_line);
+    ui_last_line = l;
+    *line = l;
+
+    if (wrapped)
+    {
+        ui_stats.frames++;
+        if (ui_frame_hook) ui_frame_hook();
+    }
+    return wrapped;
+}
+
+static uint32_t ui_lines_between(uint16_t from, uint16_t to)
+{
+    return (uint32_t)((to + ui_scan.lines - from) % ui_scan.lines);
+}
+
+// Waiting is done off the bus: the scan position is predicted from the line period and
+// read back only when it should have reached the target
+static void ui_sleep_lines(uint32_t lines)
+{
+    PERF_DelayNs(lines * ui_scan.line_ns);
+}
+
+uint8_t UI_VsyncPoll(void)
+{
+    uint16_t line;
+
+    if (ui_scan.lines == 0) UI_VsyncInit();
+    return ui_read_line(&line);
+}
+
+void UI_WaitFrameBegin(void)
+{
+    if (ui_scan.lines == 0) UI_VsyncInit();
+
+    const uint32_t frame_ms = (uint32_t)(((uint64_t)ui_scan.lines * ui_scan.line_ns) / 1000000ULL) + 1u;
+    const uint32_t t0 = HAL_GetTick();
+
+    uint16_t line;
+    if (ui_read_line(&line)) return;
+
+    // One line short of the wrap, then line by line across it
+    for (;;)
+    {
+        const uint32_t left = ui_scan.lines - line;
+        ui_sleep_lines(left > 1u ? left - 1u : 1u);
+        ui_stats.polls++;
+        if (ui_read_line(&line)) return;
+        if (HAL_GetTick() - t0 > 2u * frame_ms) return;
+    }
+}
+
+// -----------------------------
+// Job list
+// -----------------------------
+// Scanlines the scan is below y0, 0 .. lines-1 (blanking lines included)
+static uint32_t ui_scan_offset(uint16_t line, int16_t y0)
+{
+    int32_t d = ((int32_t)line - (int32_t)ui_scan.first_row - y0) % (int32_t)ui_scan.lines;
+    if (d < 0) d += ui_scan.lines;
+    return (uint32_t)d;
+}
+
+static uint64_t ui_row_ns(const SSD1963_Rect* r)
+{
+    return (uint64_t)(r->x1 - r->x0 + 1) * ui_px_ns;
+}
+
+static uint8_t ui_band_safe(const SSD1963_Rect* r, uint32_t d)
+{
+    const int64_t h = r->y1 - r->y0 + 1;
+    const int64_t row = (int64_t)ui_row_ns(r);
+    const int64_t line = ui_scan.line_ns;
+    const int64_t until_wrap = (int64_t)ui_scan.lines - (int64_t)d - UI_VSYNC_MARGIN_LINES;
+
+    if (until_wrap < 0) return 0;
+    if (h * (row - line) > line * until_wrap) return 0;
+    if (h * (line - row) > line * (int64_t)d) return 0;
+    return 1;
+}
+
+// Scanlines until r becomes safe to start, from d as above; a whole frame if it never is
+static uint32_t ui_lines_until_safe(const SSD1963_Rect* r, uint32_t d)
+{
+    const int64_t h = r->y1 - r->y0 + 1;
+    const int64_t row = (int64_t)ui_row_ns(r);
+    const int64_t line = ui_scan.line_ns;
+
+    // ui_band_safe solved for d: lo <= d <= hi
+    int64_t lo = 0;
+    int64_t hi = (int64_t)ui_scan.lines - UI_VSYNC_MARGIN_LINES;
+    if (row < line) lo = (h * (line - row) + line - 1) / line;
+    if (row > line) hi -= (h * (row - line) + line - 1) / line;
+
+    if (hi < lo) return ui_scan.lines;
+    if ((int64_t)d < lo) return (uint32_t)(lo - (int64_t)d);
+    if ((int64_t)d > hi) return (uint32_t)((int64_t)ui_scan.lines - (int64_t)d + lo);
+    return 0;
+}
+
+// Queue r, cut into bands short enough to be written behind the scan with about half a
+// frame of start window each. reserve slots are kept for the regions still to come.
+static void ui_add_jobs(const SSD1963_Rect* r, uint8_t reserve)
+{
+    const uint64_t row = ui_row_ns(r);
+    const uint64_t line = ui_scan.line_ns;
+    uint32_t band = (uint32_t)(r->y1 - r->y0 + 1);
+
+    if (row > line)
+    {
+        uint64_t fit = (line * (ui_scan.lines - UI_VSYNC_MARGIN_LINES)) / (row - line) / 2u;
+        if (fit == 0) fit = 1;
+        if (fit < band) band = (uint32_t)fit;
+    }
+
+    for (int32_t y = r->y0; y <= r->y1; y += (int32_t)band)
+    {
+        SSD1963_Rect b = { r->x0, (int16_t)y, r->x1, (int16_t)(y + (int32_t)band - 1) };
+        if (b.y1 > r->y1) b.y1 = r->y1;
+
+        // Out of slots: the rest of the region goes as one band
+        if (ui_job_count + reserve + 1u >= UI_VSYNC_MAX_JOBS) b.y1 = r->y1;
+
+        if (y != r->y0) ui_stats.splits++;
+        ui_jobs[ui_job_count++] = b;
+        if (b.y1 == r->y1) break;
+    }
+}
+
+// Top to bottom, so bands of one region follow the scan down the panel
+static void ui_sort_jobs(void)
+{
+    for (uint8_t i = 1; i < ui_job_count; i++)
+    {
+        const SSD1963_Rect r = ui_jobs[i];
+        uint8_t j = i;
+        while (j > 0 && ui_jobs[j - 1].y0 > r.y0)
+        {
+            ui_jobs[j] = ui_jobs[j - 1];
+            j--;
+        }
+        ui_jobs[j] = r;
+    }
+}
+
+static void ui_take_job(uint8_t i, SSD1963_Rect* out)
+{
+    *out = ui_jobs[i];
+    for (uint8_t j = i; j + 1u < ui_job_count; j++) ui_jobs[j] = ui_jobs[j + 1u];
+    ui_job_count--;
+}
+
+// Refine ui_px_ns from a band that took lines scanlines. Bands close to a frame long
+// may have wrapped the counter and are not trusted.
+static void ui_learn(const SSD1963_Rect* r, uint32_t lines)
+{
+    const uint64_t px = (uint64_t)(r->x1 - r->x0 + 1) * (uint64_t)(r->y1 - r->y0 + 1);
+    const uint64_t expected = px * ui_px_ns;
+
+    if (lines == 0 || expected > (uint64_t)ui_scan.line_ns * ui_scan.lines / 2u) return;
+
+    uint64_t measured = ((uint64_t)lines * ui_scan.line_ns) / px;
+    if (measured < ui_min_px_ns) measured = ui_min_px_ns;
+    ui_px_ns = (uint32_t)((3u * (uint64_t)ui_px_ns + measured) / 4u);
+}
+
+uint8_t UI_FlushSynced(UI_RedrawFn redraw)
+{
+    SSD1963_Rect regions[UI_DIRTY_MAX];
+
+    if (ui_scan.lines == 0) UI_VsyncInit();
+
+    const uint8_t n = UI_TakeDirty(regions);
+    ui_job_count = 0;
+    for (uint8_t i = 0; i < n; i++) ui_add_jobs(&regions[i], (uint8_t)(n - 1u - i));
+    ui_sort_jobs();
+
+    uint8_t written = 0;
+    uint32_t waited = 0;
+    uint16_t line;
+    ui_read_line(&line);
+
+    while (ui_job_count)
+    {
+        // Of the bands that are safe right now, take the one whose window closes first:
+        // the further the scan has moved past its top, the sooner it wraps back into it
+        int16_t pick = -1;
+        uint32_t pick_d = 0;
+        for (uint8_t i = 0; i < ui_job_count; i++)
+        {
+            const uint32_t d = ui_scan_offset(line, ui_jobs[i].y0);
+            if (ui_band_safe(&ui_jobs[i], d) && (pick < 0 || d > pick_d))
+            {
+                pick = (int16_t)i;
+                pick_d = d;
+            }
+        }
+
+        if (pick < 0)
+        {
+            // No slot for a whole frame means no slot ever (band too slow): write it anyway
+            if (waited < ui_scan.lines)
+            {
+                // Sleep until the first band's window opens instead of reading the
+                // scanline back to back
+                uint32_t wait = ui_scan.lines - waited;
+                for (uint8_t i = 0; i < ui_job_count; i++)
+                {
+                    const uint32_t w = ui_lines_until_safe(&ui_jobs[i], ui_scan_offset(line, ui_jobs[i].y0));
+                    if (w < wait) wait = w;
+                }
+                if (wait == 0) wait = 1;
+
+                ui_sleep_lines(wait);
+                ui_read_line(&line);
+                waited += wait;
+                ui_stats.polls++;
+                continue;
+            }
+            pick = 0;
+            ui_stats.forced++;
+        }
+
+        SSD1963_Rect band;
+        ui_take_job((uint8_t)pick, &band);
+
+        const uint16_t start = line;
+        SSD1963_SetClip(&band);
+        redraw(&band);
+        ui_read_line(&line);
+        ui_learn(&band, ui_lines_between(start, line));
+
+        ui_stats.jobs++;
+        written++;
+        waited = 0;
+    }
+
+    SSD1963_SetClip(NULL);
+    return written;
+}
+
+void UI_GetVsyncStats(UI_VsyncStats* out)
+{
+    *out = ui_stats;
+    out->px_ns = ui_px_ns;
+}
@@ -0,0 +1,62 @@
+#pragma once
+// Host-side SSD1963 model. Decodes the command stream the driver would put on the FMC
+// bus into an in-memory frame buffer and counts every bus transaction.
+#include <stdint.h>
+#include "stm32f7xx_hal.h"
+#include "ssd1963.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIM_WIDTH   SSD_HOR_RESOLUTION
+#define SIM_HEIGHT  SSD_VER_RESOLUTION
+
+typedef struct
+{
+    uint32_t cmd_writes;    // writes to the command address (RS low)
+    uint32_t data_writes;   // writes to the data address, parameters and pixels alike
+    uint32_t pixel_writes;  // data writes that landed in frame memory
+    uint32_t windows;       // memory write starts (0x2C)
+    uint32_t dma_beats;     // data writes that came from the DMA stream rather than the CPU
+    uint32_t data_reads;    // reads from the data address
+} SIM_BusCounters;
+
+void SIM_Reset(void);
+
+// Bus side, called through ssd1963_bus.h
+void SIM_BusCmd(uint16_t c);
+void SIM_BusData(uint16_t d);
+uint16_t SIM_BusRead(void);
+HAL_StatusTypeDef SIM_DmaStart(DMA_HandleTypeDef* hdma, const uint16_t* src, uint32_t beats);
+
+// Simulated time. Every bus access costs the FMC cycle time (set separately for writes
+// and reads, as in extended mode) and HAL_Delay advances the clock too; the scanline
+// returned by 0x45 is derived from it and the scan timing the driver programmed (0xE2,
+// 0xE6, 0xB4, 0xB6).
+void SIM_SetAccessNs(uint32_t ns);
+void SIM_SetReadNs(uint32_t ns);
+void SIM_AdvanceNs(uint64_t ns);
+uint64_t SIM_TimeNs(void);
+uint16_t SIM_Scanline(void);
+
+// Inspection. SIM_GetPixel reads frame memory, SIM_GetScreenPixel the panel row after
+// the vertical scroll (0x33 / 0x37) is applied.
+uint16_t SIM_GetPixel(uint16_t x, uint16_t y);
+uint16_t SIM_GetScreenPixel(uint16_t x, uint16_t y);
+const uint16_t* SIM_Framebuffer(void);
+uint8_t SIM_DisplayOn(void);
+uint8_t SIM_AddressMode(void);
+uint8_t SIM_TearOn(void);           // 0 = off, otherwise 1 + 0x35 mode
+uint16_t SIM_TearScanline(void);
+
+void SIM_GetCounters(SIM_BusCounters* out);
+void SIM_ResetCounters(void);
+
+// Frame dumps (RGB888). Return 0 on success.
+int SIM_DumpPPM(const char* path);
+int SIM_DumpPNG(const char* path);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,98 @@
+#pragma once
+// Host stand-in for the STM32F7 HAL. Core/Inc/main.h (and through it every firmware
+// header) pulls this in instead of the real HAL when building under Host/, so the
+// display and graphics sources compile unchanged against the simulated FMC bus.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __IO volatile
+
+typedef enum
+{
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+// -----------------------------
+// GPIO
+// -----------------------------
+typedef struct { uint32_t ODR; } GPIO_TypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef sim_gpio[5];
+#define GPIOA   (&sim_gpio[0])
+#define GPIOB   (&sim_gpio[1])
+#define GPIOC   (&sim_gpio[2])
+#define GPIOD   (&sim_gpio[3])
+#define GPIOE   (&sim_gpio[4])
+
+#define GPIO_PIN_0      ((uint16_t)0x0001)
+#define GPIO_PIN_1      ((uint16_t)0x0002)
+#define GPIO_PIN_2      ((uint16_t)0x0004)
+#define GPIO_PIN_3      ((uint16_t)0x0008)
+#define GPIO_PIN_4      ((uint16_t)0x0010)
+#define GPIO_PIN_5      ((uint16_t)0x0020)
+#define GPIO_PIN_6      ((uint16_t)0x0040)
+#define GPIO_PIN_7      ((uint16_t)0x0080)
+#define GPIO_PIN_8      ((uint16_t)0x0100)
+#define GPIO_PIN_9      ((uint16_t)0x0200)
+#define GPIO_PIN_10     ((uint16_t)0x0400)
+#define GPIO_PIN_11     ((uint16_t)0x0800)
+#define GPIO_PIN_12     ((uint16_t)0x1000)
+#define GPIO_PIN_13     ((uint16_t)0x2000)
+#define GPIO_PIN_14     ((uint16_t)0x4000)
+#define GPIO_PIN_15     ((uint16_t)0x8000)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+
+// -----------------------------
+// DMA (the memory-to-memory stream used by the LCD fills)
+// -----------------------------
+#define DMA_PINC_DISABLE    0x00000000U
+#define DMA_PINC_ENABLE     0x00000200U
+
+typedef struct
+{
+    uint32_t PeriphInc;
+} DMA_InitTypeDef;
+
+typedef struct __DMA_HandleTypeDef
+{
+    DMA_InitTypeDef Init;
+    void (*XferCpltCallback)(struct __DMA_HandleTypeDef* hdma);
+    void (*XferErrorCallback)(struct __DMA_HandleTypeDef* hdma);
+} DMA_HandleTypeDef;
+
+// -----------------------------
+// Time base: HAL_Delay advances a simulated tick instead of sleeping
+// -----------------------------
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+// -----------------------------
+// CMSIS DSP intrinsics (cmsis_gcc.h) used by the graphics code, in plain C
+// -----------------------------
+static inline uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3)
+{
+    return (uint32_t)((int32_t)(int16_t)op1 * (int16_t)op2 +
+                      (int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16) + (int32_t)op3);
+}
+
+#define __PKHBT(ARG1, ARG2, ARG3) \
+    ((((uint32_t)(ARG1)) & 0x0000FFFFUL) | ((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL))
+#define __PKHTB(ARG1, ARG2, ARG3) \
+    ((((uint32_t)(ARG1)) & 0xFFFF0000UL) | ((((uint32_t)(ARG2)) >> (ARG3)) & 0x0000FFFFUL))
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,715 @@
+// ssd1963_bench: the firmware's graphics benchmark (gfx_bench.c) on the simulated bus.
+// Bus counts and estimated FMC time match the target; CPU cycles are only measured there.
+#include "gfx_bench.h"
+#include "perf.h"
+#include "ssd1963.h"
+#include "ssd1963_sim.h"
+#include "blend565.h"
+#include "can_signal.h"
+#include "can_filter.h"
+#include "can_sched.h"
+#include "ui_signal.h"
+#include "ui_dirty.h"
+#include "ui_vsync.h"
+#include "clock_profile.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// -----------------------------
+// blend565: the DSP span loops (on the C intrinsics) against the scalar reference
+// -----------------------------
+#define CHECK_SPAN  67
+
+static uint32_t check_seed = 0x2468ACEu;
+
+static uint32_t check_rand(void)
+{
+    check_seed = check_seed * 1664525u + 1013904223u;
+    return check_seed >> 8;
+}
+
+static uint32_t check_spans(uint16_t* a, uint16_t* b, uint32_t n)
+{
+    uint32_t differ = 0;
+    for (uint32_t i = 0; i < n; i++) differ += (a[i] != b[i]);
+    return differ;
+}
+
+// Returns the number of pixels that differ; prints what was covered
+static uint32_t check_blend(void)
+{
+    static uint16_t src[CHECK_SPAN + 1], bg[CHECK_SPAN + 1], ref[CHECK_SPAN + 1], simd[CHECK_SPAN + 1];
+    static uint8_t a8[CHECK_SPAN + 1], a4[CHECK_SPAN + 1];
+    uint32_t pixels = 0, differ = 0;
+
+    // Every channel value against every channel value at every alpha, in pairs
+    for (uint32_t f = 0; f < 64; f++)
+        for (uint32_t b = 0; b < 64; b++)
+            for (uint32_t a = 0; a < 256; a += 2)
+            {
+                const uint16_t fg = (uint16_t)(((f & 31u) << 11) | (f << 5) | (31u - (f & 31u)));
+                const uint16_t bk = (uint16_t)(((b & 31u) << 11) | (b << 5) | (31u - (b & 31u)));
+                const uint16_t s2[2] = { fg, bk };
+                const uint8_t m[2] = { (uint8_t)a, (uint8_t)(a + 1u) };
+                uint16_t r[2] = { bk, fg }, d[2] = { bk, fg };
+                BLEND_RefImageA8(r, s2, m, 2);
+                BLEND_ImageA8(d, s2, m, 2);
+                differ += check_spans(r, d, 2);
+                pixels += 2;
+            }
+
+    // Random spans of every length and start, through every entry point
+    for (uint32_t round = 0; round < 4000; round++)
+    {
+        const uint32_t off = check_rand() % 2u;
+        const uint32_t n = check_rand() % (CHECK_SPAN + 1u - off);
+        const uint32_t first = check_rand() % 2u;
+        const uint16_t colour = (uint16_t)check_rand();
+        const uint8_t alpha = (uint8_t)check_rand();
+        for (uint32_t i = 0; i <= CHECK_SPAN; i++)
+        {
+            src[i] = (uint16_t)check_rand();
+            bg[i] = (uint16_t)check_rand();
+            // Mostly partial alpha, with runs of fully clear and fully opaque pixels
+            const uint32_t k = check_rand() % 4u;
+            a8[i] = (k == 0) ? 0 : (k == 1) ? 255 : (uint8_t)check_rand();
+            a4[i] = (uint8_t)check_rand();
+        }
+
+        for (uint32_t fn = 0; fn < 4; fn++)
+        {
+            memcpy(ref, bg, sizeof(bg));
+            memcpy(simd, bg, sizeof(bg));
+            switch (fn)
+            {
+            case 0:
+                BLEND_RefColour(ref + off, colour, alpha, n);
+                BLEND_Colour(simd + off, colour, alpha, n);
+                break;
+            case 1:
+                BLEND_RefColourA8(ref + off, colour, a8, n);
+                BLEND_ColourA8(simd + off, colour, a8, n);
+                break;
+            case 2:
+                BLEND_RefImageA8(ref + off, src, a8, n);
+                BLEND_ImageA8(simd + off, src, a8, n);
+                break;
+            default:
+                BLEND_RefImageA4(ref + off, src, a4, first, n);
+                BLEND_ImageA4(simd + off, src, a4, first, n);
+                break;
+            }
+            differ += check_spans(ref, simd, CHECK_SPAN + 1);
+            pixels += n;
+        }
+    }
+
+    printf("blend: %lu pixels checked against the reference, %lu differ\n",
+           (unsigned long)pixels, (unsigned long)differ);
+    return differ;
+}
+
+// -----------------------------
+// ui_vsync: waiting for the scan has to sleep between scanline reads, not spin on them
+// -----------------------------
+#define CHECK_VSYNC_FRAMES  200u
+#define CHECK_VSYNC_POLLS   8u      // most scanline reads one frame may spend waiting
+
+static void check_vsync_redraw(const SSD1963_Rect* r)
+{
+    SSD1963_FillRect(r->x0, r->y0, (int16_t)(r->x1 - r->x0 + 1), (int16_t)(r->y1 - r->y0 + 1), (uint16_t)check_rand());
+}
+
+static uint32_t check_vsync(void)
+{
+    UI_VsyncStats vs;
+    uint32_t worst = 0, over = 0;
+
+    UI_VsyncInit();
+    UI_GetVsyncStats(&vs);
+    const uint32_t polls0 = vs.polls;
+
+    for (uint32_t i = 0; i < CHECK_VSYNC_FRAMES; i++)
+    {
+        // Anything from a value box to a third of the panel, anywhere on it
+        const int16_t w = (int16_t)(8u + check_rand() % (SSD_HOR_RESOLUTION / 3u));
+        const int16_t h = (int16_t)(8u + check_rand() % (SSD_VER_RESOLUTION / 3u));
+        const int16_t x = (int16_t)(check_rand() % (uint32_t)(SSD_HOR_RESOLUTION - w));
+        const int16_t y = (int16_t)(check_rand() % (uint32_t)(SSD_VER_RESOLUTION - h));
+        const SSD1963_Rect r = { x, y, (int16_t)(x + w - 1), (int16_t)(y + h - 1) };
+
+        UI_GetVsyncStats(&vs);
+        const uint32_t before = vs.polls;
+        UI_Invalidate(&r);
+        UI_WaitFrameBegin();
+        UI_FlushSynced(check_vsync_redraw);
+        UI_GetVsyncStats(&vs);
+
+        const uint32_t polls = vs.polls - before;
+        if (polls > worst) worst = polls;
+        over += polls > CHECK_VSYNC_POLLS;
+    }
+
+    printf("vsync: %u frames, %.1f scanline polls per frame waiting, worst %lu (limit %u), %lu over\n",
+           CHECK_VSYNC_FRAMES, (double)(vs.polls - polls0) / CHECK_VSYNC_FRAMES, (unsigned long)worst,
+           CHECK_VSYNC_POLLS, (unsigned long)over);
+    return over;
+}
+
+// -----------------------------
+// can_signal: the generated tables against a bit-by-bit walk of the DBC definition
+// -----------------------------
+#define CHECK_CAN_FRAMES    20000u
+#define BENCH_CAN_BATCH     256u
+#define BENCH_CAN_NS        200000000ull
+
+static uint32_t check_bit(const uint8_t* data, uint32_t bit)
+{
+    return (data[bit / 8u] >> (bit % 8u)) & 1u;
+}
+
+// Intel signals run up from the start bit; Motorola ones start at their MSB and run down
+// through each byte, then on to the next byte's bit 7
+static float check_ref_signal(const CANSIG_Def* d, const uint8_t* data)
+{
+    uint32_t raw = 0;
+    uint32_t bit = d->start;
+    for (uint32_t i = 0; i < d->len; i++)
+    {
+        if (d->flags & CANSIG_MOTOROLA)
+        {
+            raw = (raw << 1) | check_bit(data, bit);
+            bit = (bit % 8u == 0u) ? bit + 15u : bit - 1u;
+        }
+        else
+        {
+            raw |= check_bit(data, d->start + i) << i;
+        }
+    }
+
+    int32_t v = (int32_t)raw;
+    if ((d->flags & CANSIG_SIGNED) && d->len < 32u && (raw >> (d->len - 1u)))
+        v = (int32_t)(raw | ~((1u << d->len) - 1u));
+    return ((d->flags & CANSIG_SIGNED) ? (float)v : (float)raw) * d->scale + d->offset;
+}
+
+static void check_can_frame(CANRX_Frame* f, const CANSIG_Message* m)
+{
+    memset(f, 0, sizeof(*f));
+    f->id = m->key & ~CANSIG_KEY_EXT;
+    f->flags = (m->key & CANSIG_KEY_EXT) ? CANRX_EXT : 0u;
+    f->dlc = m->dlc;
+    for (uint32_t b = 0; b < m->dlc; b++) f->data[b] = (uint8_t)check_rand();
+}
+
+// Returns the number of signals that differ (plus frames miscounted); prints what was covered
+static uint32_t check_can(void)
+{
+    uint32_t signals = 0, differ = 0;
+    memset(&cansig_store, 0, sizeof(cansig_store));
+
+    for (uint32_t i = 0; i < CHECK_CAN_FRAMES; i++)
+    {
+        const CANSIG_Message* m = &cansig_messages[check_rand() % CANDB_MESSAGE_COUNT];
+        CANRX_Frame f;
+        check_can_frame(&f, m);
+        f.tick = i + 1u;
+        CANSIG_Decode(&f, 1);
+
+        for (uint32_t s = 0; s < m->count; s++)
+            differ += cansig_store.value[m->first + s] != check_ref_signal(&cansig_defs[m->first + s], f.data);
+        differ += cansig_store.tick[m - cansig_messages] != f.tick;
+        signals += m->count;
+    }
+
+    // Identifiers outside the DBC, the other identifier width and short frames change nothing
+    CANRX_Frame f;
+    check_can_frame(&f, &cansig_messages[0]);
+    const CANSIG_Store before = cansig_store;
+    f.id = 0x7FFu;
+    CANSIG_Decode(&f, 1);
+    f.id = cansig_messages[0].key & ~CANSIG_KEY_EXT;
+    f.flags ^= CANRX_EXT;
+    CANSIG_Decode(&f, 1);
+    f.flags ^= CANRX_EXT;
+    f.dlc = 0;
+    CANSIG_Decode(&f, 1);
+    differ += memcmp(before.value, cansig_store.value, sizeof(before.value)) != 0;
+    differ += cansig_store.unknown != before.unknown + 2u || cansig_store.short_frames != before.short_frames + 1u;
+    differ += cansig_store.frames != CHECK_CAN_FRAMES;
+
+    printf("can: %lu signals in %u frames checked against the DBC, %lu differ\n",
+           (unsigned long)signals, CHECK_CAN_FRAMES, (unsigned long)differ);
+    return differ;
+}
+
+// -----------------------------
+// ui_signal: widgets invalidated from the decoded messages against polling every
+// subscription
+// -----------------------------
+#define CHECK_SIGNAL_BATCHES    2000u
+#define CHECK_SIGNAL_WIDGETS    20u
+#define CHECK_SIGNAL_SUBS       48u
+
+static uint32_t check_signal(void)
+{
+    static const float deadbands[] = { 0.0f, 0.5f, 5.0f, 50.0f };
+    static SSD1963_Rect widgets[CHECK_SIGNAL_WIDGETS];
+    static UI_SignalSub subs[CHECK_SIGNAL_SUBS];
+    static float last[CHECK_SIGNAL_SUBS];
+    static uint8_t data[CANDB_MESSAGE_COUNT][8];
+    SSD1963_Rect dirty[UI_DIRTY_MAX];
+    uint32_t differ = 0, polled = 0, invalidated = 0;
+
+    memset(&cansig_store, 0, sizeof(cansig_store));
+    memset(data, 0, sizeof(data));
+    for (uint32_t w = 0; w < CHECK_SIGNAL_WIDGETS; w++)
+        widgets[w] = (SSD1963_Rect){ (int16_t)(w % 5u * 100u), (int16_t)(w / 5u * 60u),
+                                     (int16_t)(w % 5u * 100u + 79u), (int16_t)(w / 5u * 60u + 39u) };
+    for (uint32_t i = 0; i < CHECK_SIGNAL_SUBS; i++)
+    {
+        subs[i] = (UI_SignalSub){ (CANSIG_Id)(check_rand() % CANDB_SIGNAL_COUNT),
+                                  (uint8_t)(check_rand() % CHECK_SIGNAL_WIDGETS), deadbands[check_rand() % 4u] };
+        last[i] = 0.0f;
+    }
+    differ += !UI_SignalBind(widgets, CHECK_SIGNAL_WIDGETS, subs, CHECK_SIGNAL_SUBS);
+    UI_SignalTakeChanged();
+    UI_TakeDirty(dirty);
+
+    for (uint32_t batch = 0; batch < CHECK_SIGNAL_BATCHES; batch++)
+    {
+        // A few frames, most repeating their message's last data, the rest nudging one byte
+        CANRX_Frame frames[4];
+        const uint32_t n = 1u + check_rand() % 4u;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            const uint32_t msg = check_rand() % CANDB_MESSAGE_COUNT;
+            const CANSIG_Message* m = &cansig_messages[msg];
+            if (check_rand() % 3u == 0u) data[msg][check_rand() % m->dlc] ^= (uint8_t)(1u << (check_rand() % 8u));
+            check_can_frame(&frames[i], m);
+            memcpy(frames[i].data, data[msg], 8);
+        }
+        CANSIG_Decode(frames, n);
+        UI_SignalPublish();
+
+        // Polling reference: every subscription, decoded this batch or not
+        uint32_t expect = 0;
+        for (uint32_t i = 0; i < CHECK_SIGNAL_SUBS; i++)
+        {
+            const float v = cansig_store.value[subs[i].signal];
+            const float d = v - last[i];
+            if (d > subs[i].deadband || d < -subs[i].deadband)
+            {
+                last[i] = v;
+                expect |= 1u << subs[i].widget;
+            }
+        }
+        polled += CHECK_SIGNAL_SUBS;
+        invalidated += (uint32_t)__builtin_popcount(expect);
+        differ += UI_SignalTakeChanged() != expect;
+        UI_TakeDirty(dirty);
+    }
+
+    UI_SignalStats st;
+    UI_SignalGetStats(&st);
+    differ += st.invalidated != invalidated;
+    printf("signal bus: %u batches, %lu widget repaints, %lu subscription checks (polling: %lu), %lu differ\n",
+           (unsigned)CHECK_SIGNAL_BATCHES, (unsigned long)st.invalidated, (unsigned long)st.checks,
+           (unsigned long)polled, (unsigned long)differ);
+    return differ;
+}
+
+// -----------------------------
+// can_filter: planned banks accept exactly the subscribed data frames
+// -----------------------------
+#define CHECK_FILTER_PLANS  400u
+
+static uint8_t check_subscribed(const uint32_t* keys, uint32_t n, uint32_t key)
+{
+    for (uint32_t i = 0; i < n; i++)
+        if (keys[i] == key) return 1;
+    return 0;
+}
+
+// Every standard identifier, every subscribed extended one with each of its bits flipped,
+// and random extended ones, as data and as remote frames. Returns the wrong decisions.
+static uint32_t check_plan(const CANFLT_Plan* plan, const uint32_t* keys, uint32_t n)
+{
+    uint32_t wrong = 0;
+    for (uint32_t id = 0; id < 0x800u; id++)
+    {
+        wrong += CANFLT_Match(plan, id, 0, NULL) != check_subscribed(keys, n, id);
+        wrong += CANFLT_Match(plan, id, 1, NULL);
+    }
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (!(keys[i] & CANFLT_EXT)) continue;
+        for (uint32_t b = 0; b < 29u; b++)
+        {
+            const uint32_t key = keys[i] ^ (1u << b);
+            wrong += CANFLT_Match(plan, key, 0, NULL) != check_subscribed(keys, n, key);
+        }
+        wrong += CANFLT_Match(plan, keys[i], 0, NULL) != 1u;
+        wrong += CANFLT_Match(plan, keys[i], 1, NULL);
+        // The same low bits as a standard identifier
+        wrong += CANFLT_Match(plan, keys[i] & 0x7FFu, 0, NULL) != check_subscribed(keys, n, keys[i] & 0x7FFu);
+    }
+    for (uint32_t i = 0; i < 2000u; i++)
+    {
+        const uint32_t key = CANFLT_EXT | (((check_rand() << 5) ^ check_rand()) & 0x1FFFFFFFu);
+        wrong += CANFLT_Match(plan, key, 0, NULL) != check_subscribed(keys, n, key);
+    }
+    return wrong;
+}
+
+static uint32_t check_filter(void)
+{
+    static uint32_t keys[CANFLT_MAX_IDS];
+    static CANFLT_Plan plan;
+    uint32_t wrong = 0, plans = 0, banks = 0, ids = 0, over = 0;
+
+    for (uint32_t round = 0; round < CHECK_FILTER_PLANS; round++)
+    {
+        // Scattered identifiers mixed with runs and strided groups, standard and extended
+        uint32_t n = 0;
+        const uint32_t groups = 1u + check_rand() % 12u;
+        for (uint32_t g = 0; g < groups && n < 48u; g++)
+        {
+            const uint32_t ext = (check_rand() % 3u == 0u) ? CANFLT_EXT : 0u;
+            const uint32_t base = ext ? (check_rand() & 0x1FFFFFFFu) : (check_rand() & 0x7FFu);
+            const uint32_t len = 1u + check_rand() % 8u;
+            const uint32_t stride = 1u << (check_rand() % 4u);
+            for (uint32_t k = 0; k < len && n < 48u; k++)
+                keys[n++] = ext | ((base + k * stride) & (ext ? 0x1FFFFFFFu : 0x7FFu));
+        }
+
+        if (CANFLT_Build(&plan, keys, n, NULL) == 0)
+        {
+            over++;
+            continue;
+        }
+        wrong += check_plan(&plan, keys, n);
+        plans++;
+        banks += plan.count;
+        ids += n;
+    }
+
+    // The DBC's own messages, as the firmware subscribes them
+    for (uint32_t i = 0; i < CANDB_MESSAGE_COUNT; i++) keys[i] = cansig_messages[i].key;
+    const uint32_t dbc_banks = CANFLT_Build(&plan, keys, CANDB_MESSAGE_COUNT, NULL);
+    wrong += dbc_banks ? check_plan(&plan, keys, CANDB_MESSAGE_COUNT) : 1u;
+
+    printf("filter: %lu plans (%lu ids in %lu banks, %lu over %u banks), %lu wrong; DBC: %u messages in %lu banks\n",
+           (unsigned long)plans, (unsigned long)ids, (unsigned long)banks, (unsigned long)over, (unsigned)CANFLT_BANKS,
+           (unsigned long)wrong, (unsigned)CANDB_MESSAGE_COUNT, (unsigned long)dbc_banks);
+    return wrong;
+}
+
+// -----------------------------
+// CAN bit timing: the runtime solver against the compile-time macros
+// -----------------------------
+static uint32_t check_can_timing(void)
+{
+    static const uint32_t pclks[] = { 16000000u, 24000000u, 27000000u, 36000000u, 42000000u, 45000000u,
+                                      48000000u, 50000000u, 54000000u };
+    static const uint32_t rates[] = { 125000u, 250000u, 500000u, 800000u, 1000000u };
+    uint32_t cases = 0, wrong = 0;
+
+    for (uint32_t p = 0; p < sizeof(pclks) / sizeof(pclks[0]); p++)
+        for (uint32_t r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+        {
+            const uint32_t pclk = pclks[p], rate = rates[r];
+            CLK_CanBitTiming t;
+            const uint8_t found = CLK_CanTiming(pclk, rate, CLK_CAN_SAMPLE_PERMILLE, &t);
+            const uint32_t n = CLK_CAN_TQ(pclk, rate);
+            cases++;
+
+            if (n == 0u)
+            {
+                // No exact rate: the solver may still find one within tolerance
+                wrong += found && t.error_ppm == 0u;
+                continue;
+            }
+            wrong += !found || t.error_ppm != 0u || t.prescaler != CLK_CAN_PRESCALER(pclk, rate) ||
+                     t.bs1 != CLK_CAN_BS1(n) || t.bs2 != CLK_CAN_BS2(n) || t.sjw != CLK_CAN_SJW(n);
+        }
+
+    CLK_CanBitTiming t;
+    CLK_CanTiming(CLK_PCLK1_HZ, CLK_CAN2_BITRATE, CLK_CAN_SAMPLE_PERMILLE, &t);
+    printf("can timing: %lu clock/rate pairs against the macros, %lu wrong; %lu bit/s at %lu Hz: "
+           "prescaler %u, %u+%u+1 tq, sjw %u, sample %u.%u%%\n",
+           (unsigned long)cases, (unsigned long)wrong, (unsigned long)CLK_CAN2_BITRATE, (unsigned long)CLK_PCLK1_HZ,
+           t.prescaler, t.bs1, t.bs2, t.sjw, t.sample_permille / 10u, t.sample_permille % 10u);
+    return wrong;
+}
+
+// -----------------------------
+// CAN transmit scheduler against a model of the three bxCAN mailboxes
+// -----------------------------
+#define CHECK_SCHED_TRIALS      2000u
+#define CHECK_SCHED_IDS         16u
+#define CHECK_SCHED_HIGH_ID     0x010u
+#define CHECK_SCHED_MS          10000u
+
+typedef struct
+{
+    uint8_t  pending;       // mailboxes with TXRQ set
+    uint32_t key[CANSCHED_MAILBOXES];
+    uint32_t order[CANSCHED_MAILBOXES];
+    uint32_t tag[CANSCHED_MAILBOXES];
+    uint32_t requests;
+    uint32_t lost;          // completions whose RQCP someone else cleared
+} check_Bus;
+
+// A mailbox completes. Now and then its RQCP is cleared before the service pass sees it,
+// as HAL_CAN_IRQHandler does on a receive vector; the mailbox is just empty then. Not
+// for a frame sent while its abort was pending: CANSCHED_Settle resends that one.
+static void check_bus_complete(CANSCHED_State* s, check_Bus* bus, uint32_t mb, uint8_t sent, uint32_t now)
+{
+    bus->pending &= (uint8_t)~(1u << mb);
+    if (!(sent && (s->aborting & (1u << mb))) && check_rand() % 4u == 0u) bus->lost++;
+    else CANSCHED_Done(s, (uint8_t)mb, sent, now);
+}
+
+// As can_tx.c's service pass; aborts land at once except on the mailbox on the wire,
+// which completes instead
+static void check_bus_service(CANSCHED_State* s, check_Bus* bus, uint32_t on_wire, uint32_t now)
+{
+    uint8_t free = (uint8_t)(~bus->pending & 7u);
+    CANSCHED_Settle(s, free, now);
+    const uint8_t abort = CANSCHED_Preempt(s, free);
+    uint8_t mb;
+    for (mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+    {
+        if (!(abort & (1u << mb)) || mb == on_wire) continue;
+        check_bus_complete(s, bus, mb, 0, now);
+    }
+
+    // The aborts' own completions come later on the target; the freed mailboxes are
+    // refilled on the next pass there, here right away
+    free = (uint8_t)(~bus->pending & 7u);
+    CANSCHED_Frame f;
+    while ((mb = CANSCHED_Next(s, free, &f)) != CANSCHED_NONE)
+    {
+        bus->pending |= (uint8_t)(1u << mb);
+        bus->key[mb] = CANSCHED_Key(f.id, f.flags);
+        bus->order[mb] = bus->requests++;
+        memcpy(&bus->tag[mb], f.data, 4);
+        free &= (uint8_t)~(1u << mb);
+    }
+}
+
+// The mailbox the controller sends next: lowest identifier (then mailbox number), or the
+// oldest request with TransmitFifoPriority
+static uint32_t check_bus_pick(const check_Bus* bus, uint8_t fifo_order)
+{
+    uint32_t pick = CANSCHED_NONE;
+    for (uint32_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+    {
+        if (!(bus->pending & (1u << mb))) continue;
+        if (pick == CANSCHED_NONE || (fifo_order ? bus->order[mb] < bus->order[pick] : bus->key[mb] < bus->key[pick]))
+            pick = mb;
+    }
+    return pick;
+}
+
+static uint8_t check_sched_queue(CANSCHED_State* s, uint32_t id, uint8_t flags, uint32_t tag)
+{
+    CANSCHED_Frame f = { .id = id, .dlc = 8, .flags = flags };
+    memcpy(f.data, &tag, 4);
+    return CANSCHED_Queue(s, &f);
+}
+
+// One of CHECK_SCHED_IDS background identifiers, standard or extended, all below the
+// high-priority one in rank
+static void check_sched_background(uint32_t i, uint32_t* id, uint8_t* flags)
+{
+    *flags = (i & 1u) ? CANRX_EXT : 0u;
+    *id = (i & 1u) ? (((0x100u + i * 0x30u) << 18) | (i * 7u)) : (0x100u + i * 0x30u);
+}
+
+// Waiting frames leave in arbitration order (queue order on a tie) and a high-priority
+// frame queued under full load is the very next frame on the wire
+static uint32_t check_sched_order(uint8_t fifo_order, uint32_t* waits, uint32_t* lost)
+{
+    static CANSCHED_State s;
+    uint32_t wrong = 0;
+
+    for (uint32_t trial = 0; trial < CHECK_SCHED_TRIALS; trial++)
+    {
+        check_Bus bus = { 0 };
+        uint32_t last_tag[CHECK_SCHED_IDS + 1];
+        memset(last_tag, 0, sizeof(last_tag));
+        uint32_t tag = 1, high_tag = 0, started_since = 0;
+        const uint32_t frames = 20u + check_rand() % 40u;
+        const uint32_t high_at = check_rand() % frames;
+
+        CANSCHED_Init(&s, fifo_order);
+        for (uint32_t f = 0; f < frames + CANSCHED_QUEUE_SIZE + CANSCHED_MAILBOXES; f++)
+        {
+            // Keep the queue close to full
+            while (f < frames && s.free_count > check_rand() % 4u)
+            {
+                const uint32_t i = check_rand() % CHECK_SCHED_IDS;
+                uint32_t id;
+                uint8_t flags;
+                check_sched_background(i, &id, &flags);
+                check_sched_queue(&s, id, flags, (tag++ << 5) | i);
+            }
+            check_bus_service(&s, &bus, CANSCHED_NONE, 0);
+
+            const uint32_t wire = check_bus_pick(&bus, fifo_order);
+            if (wire == CANSCHED_NONE) break;
+
+            // Nothing waiting may outrank the frame that won arbitration
+            if (s.count && s.heap[0].key < bus.key[wire]) wrong++;
+            for (uint32_t mb = 0; mb < CANSCHED_MAILBOXES; mb++)
+                if ((bus.pending & (1u << mb)) && bus.key[mb] < bus.key[wire]) wrong++;
+
+            if (high_tag)
+            {
+                if (bus.tag[wire] == high_tag)
+                {
+                    if (started_since > *waits) *waits = started_since;
+                    high_tag = 0;
+                }
+                else
+                {
+                    started_since++;
+                }
+            }
+
+            // The high-priority frame turns up while this one is on the wire
+            if (f == high_at)
+            {
+                high_tag = (tag++ << 5) | CHECK_SCHED_IDS;
+                started_since = 0;
+                check_sched_queue(&s, CHECK_SCHED_HIGH_ID, 0, high_tag);
+                check_bus_service(&s, &bus, wire, 0);
+            }
+
+            // Frames of one identifier in queue order; tags carry the identifier's index
+            const uint32_t idx = bus.tag[wire] & 31u;
+            if ((bus.tag[wire] >> 5) < last_tag[idx]) wrong++;
+            last_tag[idx] = bus.tag[wire] >> 5;
+
+            check_bus_complete(&s, &bus, wire, 1, 0);
+        }
+        wrong += (high_tag != 0u);
+
+        // Every completion whose flag went missing was still accounted for, and only those
+        check_bus_service(&s, &bus, CANSCHED_NONE, 0);
+        wrong += (s.stats.settled != bus.lost) + (s.loaded != 0u);
+        *lost += bus.lost;
+    }
+    return wrong;
+}
+
+static uint32_t check_sched(void)
+{
+    uint32_t wrong = 0, waits[2] = { 0, 0 }, lost = 0;
+    for (uint8_t fifo = 0; fifo < 2u; fifo++) wrong += check_sched_order(fifo, &waits[fifo], &lost);
+
+    // Periodic messages under a saturated bus, one frame a millisecond
+    static CANSCHED_State s;
+    static const uint16_t periods[] = { 10, 25, 100 }, jitters[] = { 2, 5, 10 };
+    check_Bus bus = { 0 };
+    CANSCHED_Init(&s, 0);
+    for (uint32_t i = 0; i < 3u; i++) CANSCHED_AddPeriodic(&s, 0x050u + i, 0, 8, periods[i], jitters[i], 0);
+
+    for (uint32_t now = 0; now < CHECK_SCHED_MS; now++)
+    {
+        uint32_t id;
+        uint8_t flags;
+        check_sched_background(check_rand() % CHECK_SCHED_IDS, &id, &flags);
+        while (s.free_count) check_sched_queue(&s, id, flags, now);
+
+        CANSCHED_Tick(&s, now);
+        check_bus_service(&s, &bus, CANSCHED_NONE, now);
+        const uint32_t wire = check_bus_pick(&bus, 0);
+        if (wire == CANSCHED_NONE) continue;
+        check_bus_complete(&s, &bus, wire, 1, now + 1u);
+    }
+    lost += bus.lost;
+
+    uint32_t late = 0, worst = 0;
+    for (uint32_t i = 0; i < 3u; i++)
+    {
+        const CANSCHED_Periodic* p = &s.periodic[i];
+        wrong += (p->sent != CHECK_SCHED_MS / p->period_ms) + (p->skipped != 0u);
+        late += p->late;
+        if (p->worst_ms > worst) worst = p->worst_ms;
+    }
+    wrong += late;
+
+    printf("can tx: %u trials per priority mode, high-priority frame waited %lu / %lu extra frames (id / fifo); "
+           "periodic on a full bus: %lu late, worst %lu ms; %lu completions without RQCP; %lu wrong\n",
+           (unsigned)CHECK_SCHED_TRIALS, (unsigned long)waits[0], (unsigned long)waits[1], (unsigned long)late,
+           (unsigned long)worst, (unsigned long)lost, (unsigned long)wrong);
+    return wrong;
+}
+
+static uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Host throughput of CANSIG_Decode over a batch cycling through every message
+static void bench_can(void)
+{
+    static CANRX_Frame frames[BENCH_CAN_BATCH];
+    uint32_t signals = 0;
+    for (uint32_t i = 0; i < BENCH_CAN_BATCH; i++)
+    {
+        check_can_frame(&frames[i], &cansig_messages[i % CANDB_MESSAGE_COUNT]);
+        signals += cansig_messages[i % CANDB_MESSAGE_COUNT].count;
+    }
+
+    uint64_t batches = 0;
+    const uint64_t t0 = bench_now_ns();
+    uint64_t t1;
+    do
+    {
+        for (uint32_t r = 0; r < 64u; r++) CANSIG_Decode(frames, BENCH_CAN_BATCH);
+        batches += 64u;
+        t1 = bench_now_ns();
+    } while (t1 - t0 < BENCH_CAN_NS);
+
+    const double s = (double)(t1 - t0) * 1e-9;
+    const double fps = (double)(batches * BENCH_CAN_BATCH) / s;
+    printf("can decode (host): %.2f M frames/s, %.1f ns/frame, %.1f signals/frame\n",
+           fps * 1e-6, 1e9 / fps, (double)signals / BENCH_CAN_BATCH);
+}
+
+int main(void)
+{
+    static GFXBENCH_Result results[GFXBENCH_MAX_RESULTS];
+
+    SIM_Reset();
+    SSD1963_Init();
+    PERF_Init();
+
+    // Let the simulated scan see the same bus time the estimates are based on
+    PERF_BusTiming t;
+    PERF_GetBusTiming(&t);
+    SIM_SetAccessNs(PERF_BusWriteNs(&t));
+    SIM_SetReadNs(PERF_BusReadNs(&t));
+
+    const uint32_t n = GFXBENCH_Run(results, GFXBENCH_MAX_RESULTS);
+    GFXBENCH_Print(results, n);
+
+    bench_can();
+
+    const uint32_t blend_differ = check_blend();
+    const uint32_t vsync_over = check_vsync();
+    const uint32_t can_differ = check_can();
+    const uint32_t signal_differ = check_signal();
+    const uint32_t filter_wrong = check_filter();
+    const uint32_t timing_wrong = check_can_timing();
+    const uint32_t sched_wrong = check_sched();
+    return (blend_differ || vsync_over || can_differ || signal_differ || filter_wrong || timing_wrong || sched_wrong) ? 1 : 0;
+}
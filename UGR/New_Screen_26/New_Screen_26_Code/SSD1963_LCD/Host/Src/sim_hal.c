@@ -0,0 +1,35 @@
+// Host implementations of the few HAL services the display code uses
+#include "main.h"
+#include "dma.h"
+#include "ssd1963_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+GPIO_TypeDef sim_gpio[5];
+DMA_HandleTypeDef hdma_memtomem_dma2_stream0;
+
+static uint32_t sim_tick;
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState == GPIO_PIN_SET) GPIOx->ODR |= GPIO_Pin;
+    else                          GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    sim_tick += Delay;
+    SIM_AdvanceNs((uint64_t)Delay * 1000000ULL);
+}
+
+uint32_t HAL_GetTick(void)
+{
+    return sim_tick;
+}
+
+void Error_Handler(void)
+{
+    fprintf(stderr, "Error_Handler called\n");
+    abort();
+}
@@ -0,0 +1,243 @@
+// ssd1963_sim: runs the real driver and graphics layers against the simulated bus,
+// prints bus traffic per frame and dumps each frame as PPM + PNG.
+//
+//   ssd1963_sim [output_dir]
+#include "ssd1963.h"
+#include "ssd1963_gfx.h"
+#include "ssd1963_font.h"
+#include "ssd1963_shapes.h"
+#include "tile_render.h"
+#include "fonts.h"
+#include "ssd1963_image.h"
+#include "images.h"
+#include "ssd1963_sim.h"
+#include "perf.h"
+#include "ui_dirty.h"
+#include "ui_vsync.h"
+#include "ui_chart.h"
+#include "ssd1963_capture.h"
+
+#include <stdio.h>
+
+#define BG_COLOUR   RGB565(16, 16, 24)
+#define BOX_COLOUR  RGB565(40, 40, 56)
+#define BAR_COLOUR  RGB565(255, 64, 0)
+
+static const SSD1963_Rect rpm_box = { 40, 40, 759, 119 };
+static const SSD1963_Rect gear_box = { 340, 180, 459, 339 };
+
+static uint16_t rpm_fill;   // 0..720 pixels of bar
+static uint16_t icon[32 * 32];
+
+// Paints every widget that intersects area; the clip is already set by UI_Flush
+static void redraw(const SSD1963_Rect* area)
+{
+    (void)area;
+
+    SSD1963_FillRect(0, 0, SSD_HOR_RESOLUTION, SSD_VER_RESOLUTION, BG_COLOUR);
+
+    SSD1963_FillRect(rpm_box.x0, rpm_box.y0, rpm_box.x1 - rpm_box.x0 + 1, rpm_box.y1 - rpm_box.y0 + 1, BOX_COLOUR);
+    SSD1963_FillRect(rpm_box.x0, rpm_box.y0, (int16_t)rpm_fill, rpm_box.y1 - rpm_box.y0 + 1, BAR_COLOUR);
+
+    SSD1963_FillRect(gear_box.x0, gear_box.y0, gear_box.x1 - gear_box.x0 + 1, gear_box.y1 - gear_box.y0 + 1, BOX_COLOUR);
+    SSD1963_Blit(384, 244, 32, 32, icon);
+    SSD1963_DrawText(385, 181, &font_digits48, "4", 0xFFFF, BOX_COLOUR);
+
+    SSD1963_DrawText(rpm_box.x0, 16, &font_lato16, "RPM x1000", 0xFFFF, BG_COLOUR);
+    SSD1963_DrawText(40, 380, &font_mono12, "WATER  92.5 C\nOIL     4.1 bar", RGB565(160, 200, 255), BG_COLOUR);
+    SSD1963_DrawText(520, 380, &font_digits48, "1:23.456", 0xFFFF, BG_COLOUR);
+}
+
+// Same widgets composited in strips: gradient, translucent banner, text blended over both
+static void scene(const TILE_Target* t)
+{
+    static const SSD1963_Rect screen = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+    static const SSD1963_Rect banner = { 0, 140, SSD_HOR_RESOLUTION - 1, 219 };
+
+    TILE_FillGradient(t, &screen, RGB565(40, 40, 64), RGB565(8, 8, 12));
+    TILE_Fill(t, &rpm_box, BOX_COLOUR);
+    TILE_Fill(t, &(SSD1963_Rect){ rpm_box.x0, rpm_box.y0, (int16_t)(rpm_box.x0 + rpm_fill - 1), rpm_box.y1 }, BAR_COLOUR);
+    TILE_Fill(t, &gear_box, BOX_COLOUR);
+    TILE_Blit(t, 384, 244, 32, 32, icon);
+    TILE_DrawText(t, 40, 16, &font_lato16, "RPM x1000", 0xFFFF);
+    TILE_DrawText(t, 520, 380, &font_digits48, "1:23.456", 0xFFFF);
+
+    TILE_FillAlpha(t, &banner, RGB565(255, 0, 0), 140);
+    TILE_DrawText(t, 250, 150, &font_digits48, "-0.412", 0xFFFF);
+}
+
+// Telemetry strip chart under a fixed header: time runs down, one lane per channel
+static const UI_Chart chart = {
+    .y0 = 120, .rows = 360,
+    .bg = RGB565(8, 8, 12), .grid = RGB565(48, 48, 64), .grid_every = 50,
+    .traces = 3,
+    .trace = {
+        { 40, 239, 0, 800, RGB565(255, 160, 0) },       // oil pressure, kPa
+        { 300, 499, 700, 1300, RGB565(0, 200, 255) },   // lambda x1000
+        { 560, 759, 0, 100, RGB565(120, 255, 80) },     // throttle, %
+    },
+};
+
+// Capture sinks: a PPM file, and a comparison against the model's frame memory
+static uint8_t sink_file(void* ctx, const uint8_t* data, uint32_t len)
+{
+    return fwrite(data, 1, len, (FILE*)ctx) == len;
+}
+
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t differ;
+} CaptureCompare;
+
+static uint8_t sink_compare(void* ctx, const uint8_t* data, uint32_t len)
+{
+    CaptureCompare* c = (CaptureCompare*)ctx;
+    const uint16_t* fb = SIM_Framebuffer();
+    for (uint32_t i = 0; i + 1 < len; i += 2, c->pixels++)
+    {
+        if (fb[c->pixels] != (uint16_t)(data[i] | (data[i + 1] << 8))) c->differ++;
+    }
+    return 1;
+}
+
+static void report(const char* what, const char* dir, int frame)
+{
+    SIM_BusCounters c;
+    SIM_GetCounters(&c);
+    printf("%-12s cmd=%7u data=%8u pixels=%8u windows=%5u dma=%8u reads=%4u\n",
+           what, c.cmd_writes, c.data_writes, c.pixel_writes, c.windows, c.dma_beats, c.data_reads);
+    SIM_ResetCounters();
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/frame_%03d.ppm", dir, frame);
+    if (SIM_DumpPPM(path) != 0) fprintf(stderr, "could not write %s\n", path);
+    snprintf(path, sizeof(path), "%s/frame_%03d.png", dir, frame);
+    if (SIM_DumpPNG(path) != 0) fprintf(stderr, "could not write %s\n", path);
+}
+
+int main(int argc, char** argv)
+{
+    const char* dir = (argc > 1) ? argv[1] : ".";
+
+    for (int y = 0; y < 32; y++)
+        for (int x = 0; x < 32; x++)
+            icon[y * 32 + x] = RGB565(x * 8, y * 8, 128);
+
+    PERF_BusTiming t;
+    PERF_GetBusTiming(&t);
+
+    SIM_Reset();
+    SIM_SetAccessNs(PERF_BusWriteNs(&t));
+    SIM_SetReadNs(PERF_BusReadNs(&t));
+    SSD1963_Init();
+    report("init", dir, 0);
+
+    SSD1963_FillAsync(BG_COLOUR, NULL);
+    SSD1963_WaitIdle();
+    report("clear", dir, 1);
+
+    UI_InvalidateAll();
+    UI_Flush(redraw);
+    report("full", dir, 2);
+
+    // Live RPM: only the bar region changes from frame to frame, flushed behind the scan
+    UI_VsyncInit();
+    for (int frame = 3; frame < 8; frame++)
+    {
+        const uint16_t old_fill = rpm_fill;
+        rpm_fill = (uint16_t)(rpm_fill + 90);
+
+        const SSD1963_Rect changed = {
+            (int16_t)(rpm_box.x0 + old_fill), rpm_box.y0,
+            (int16_t)(rpm_box.x0 + rpm_fill - 1), rpm_box.y1
+        };
+        UI_Invalidate(&changed);
+        UI_WaitFrameBegin();
+        UI_FlushSynced(redraw);
+
+        char name[16];
+        snprintf(name, sizeof(name), "rpm %d", frame - 2);
+        report(name, dir, frame);
+    }
+
+    // Compressed assets decoded straight into the window
+    SSD1963_DrawImage(0, 0, &img_dash_bg);
+    SSD1963_DrawImage(376, 236, &img_warning);
+    report("images", dir, 8);
+
+    // Sweep gauge: track, value arc, needle and hub
+    SSD1963_FillRect(0, 0, SSD_HOR_RESOLUTION, SSD_VER_RESOLUTION, BG_COLOUR);
+    SSD1963_DrawArc(400, 260, 180, 20, SSD1963_DEG(135), SSD1963_DEG(270), BOX_COLOUR);
+    SSD1963_DrawArc(400, 260, 180, 20, SSD1963_DEG(135), SSD1963_DEG(200), BAR_COLOUR);
+    for (int i = 0; i <= 9; i++)
+    {
+        const int32_t a = SSD1963_DEG(135 + i * 30);
+        SSD1963_DrawThickLine((int16_t)(400 + ((SSD1963_Cos(a) * 150) >> 15)), (int16_t)(260 + ((SSD1963_Sin(a) * 150) >> 15)),
+                              (int16_t)(400 + ((SSD1963_Cos(a) * 135) >> 15)), (int16_t)(260 + ((SSD1963_Sin(a) * 135) >> 15)),
+                              3, 0xFFFF);
+    }
+    const int32_t needle = SSD1963_DEG(135 + 200);
+    SSD1963_DrawThickLine(400, 260, (int16_t)(400 + ((SSD1963_Cos(needle) * 150) >> 15)),
+                          (int16_t)(260 + ((SSD1963_Sin(needle) * 150) >> 15)), 5, RGB565(255, 0, 0));
+    SSD1963_FillCircle(400, 260, 14, 0xFFFF);
+    SSD1963_DrawCircle(400, 260, 196, BOX_COLOUR);
+    report("gauge", dir, 9);
+
+    // Composited frame through the strip renderer
+    TILE_Render(&(SSD1963_Rect){ 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 }, scene);
+    SSD1963_WaitIdle();
+    TILE_Stats ts;
+    TILE_GetStats(&ts);
+    report("tiles", dir, 10);
+    printf("tiles: strips=%u\n", ts.strips);
+
+    // Read the composited frame back: once as a PPM, once against frame memory
+    const SSD1963_Rect screen = { 0, 0, SSD_HOR_RESOLUTION - 1, SSD_VER_RESOLUTION - 1 };
+    char path[512];
+    snprintf(path, sizeof(path), "%s/capture_010.ppm", dir);
+    FILE* f = fopen(path, "wb");
+    if (f)
+    {
+        SSD1963_Capture(&screen, SSD1963_CAPTURE_PPM, sink_file, f);
+        fclose(f);
+    }
+    CaptureCompare cmp = { 0 };
+    SIM_ResetCounters();
+    SSD1963_Capture(&screen, SSD1963_CAPTURE_RGB565, sink_compare, &cmp);
+    SIM_BusCounters cc;
+    SIM_GetCounters(&cc);
+    SIM_ResetCounters();
+    printf("capture: pixels=%u differ=%u cmd=%u reads=%u\n", cmp.pixels, cmp.differ, cc.cmd_writes, cc.data_reads);
+
+    // Strip chart: 500 samples through a 360-row band, so the history has wrapped
+    SSD1963_FillRect(0, 0, SSD_HOR_RESOLUTION, 120, BG_COLOUR);
+    SSD1963_DrawText(40, 90, &font_lato16, "OIL", 0xFFFF, BG_COLOUR);
+    SSD1963_DrawText(300, 90, &font_lato16, "LAMBDA", 0xFFFF, BG_COLOUR);
+    SSD1963_DrawText(560, 90, &font_lato16, "THROTTLE", 0xFFFF, BG_COLOUR);
+    UI_ChartStart(&chart);
+    SIM_BusCounters before, after;
+    for (int i = 0; i < 500; i++)
+    {
+        const int32_t a = SSD1963_DEG(i * 3);
+        const int32_t v[3] = {
+            400 + ((SSD1963_Sin(a) * 250) >> 15),
+            1000 + ((SSD1963_Sin(a * 7) * 120) >> 15) + ((i % 40) < 3 ? 150 : 0),
+            (i % 120) < 60 ? 100 : 20,
+        };
+        SIM_GetCounters(&before);
+        UI_ChartPush(v);
+        SIM_GetCounters(&after);
+    }
+    report("chart", dir, 11);
+    printf("chart: per sample cmd=%u data=%u\n",
+           after.cmd_writes - before.cmd_writes, after.data_writes - before.data_writes);
+    UI_ChartStop();
+
+    UI_VsyncStats vs;
+    UI_GetVsyncStats(&vs);
+    printf("vsync: frames=%u bands=%u splits=%u forced=%u polls=%u px=%u ns\n",
+           vs.frames, vs.jobs, vs.splits, vs.forced, vs.polls, vs.px_ns);
+
+    return 0;
+}
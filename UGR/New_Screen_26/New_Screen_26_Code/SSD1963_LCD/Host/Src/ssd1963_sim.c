@@ -0,0 +1,514 @@
+#include "ssd1963_sim.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// -----------------------------
+// Controller state
+// -----------------------------
+#define SIM_MAX_PARAMS  16
+
+// Default FMC access: CubeMX's 2 + 10 + 1 + 15 HCLK at 16 MHz. Callers normally set the
+// profile's real figures with SIM_SetAccessNs(PERF_BusWriteNs(...)) and SIM_SetReadNs.
+#define SIM_DEFAULT_ACCESS_NS   1750u
+// SSD1963 reference oscillator on this board
+#define SIM_OSC_HZ              10000000ULL
+
+// 0x36 set_address_mode bits that change where frame memory writes land
+#define SIM_MADCTL_PAGE_ORDER   (1u << 7)
+#define SIM_MADCTL_COL_ORDER    (1u << 6)
+#define SIM_MADCTL_EXCHANGE     (1u << 5)
+#define SIM_MADCTL_BGR          (1u << 3)
+
+typedef enum
+{
+    SIM_MODE_PARAM = 0,
+    SIM_MODE_MEM_WRITE,
+    SIM_MODE_MEM_READ,
+    SIM_MODE_READ
+} SIM_Mode;
+
+static uint16_t sim_fb[SIM_WIDTH * SIM_HEIGHT];
+
+static uint8_t  sim_cmd;
+static SIM_Mode sim_mode;
+static uint8_t  sim_params[SIM_MAX_PARAMS];
+static uint8_t  sim_nparams;
+
+static uint16_t sim_sc, sim_ec;     // column window
+static uint16_t sim_sp, sim_ep;     // page window
+static uint16_t sim_wx, sim_wy;     // memory write pointer
+static uint8_t  sim_madctl;
+static uint8_t  sim_pixel_format;
+static uint8_t  sim_display_on;
+static uint8_t  sim_tear_on;
+static uint16_t sim_tear_line;
+static uint16_t sim_tfa, sim_vsa;   // scroll area (0x33); the bottom fixed area is the rest
+static uint16_t sim_vsp;            // scroll start (0x37)
+
+// Read-back queue filled by query commands
+static uint8_t  sim_rd[4];
+static uint8_t  sim_rd_len, sim_rd_pos;
+
+// Scan timing registers (0 until the driver programs them)
+static uint8_t  sim_pll_n, sim_pll_m;
+static uint32_t sim_fpr;
+static uint16_t sim_ht, sim_vt;
+
+static uint64_t sim_time_ns;
+static uint32_t sim_access_ns = SIM_DEFAULT_ACCESS_NS;
+static uint32_t sim_read_ns = SIM_DEFAULT_ACCESS_NS;
+
+static SIM_BusCounters sim_count;
+
+static void sim_reset_registers(void)
+{
+    sim_cmd = 0;
+    sim_mode = SIM_MODE_PARAM;
+    sim_nparams = 0;
+    sim_sc = 0; sim_ec = SIM_WIDTH - 1;
+    sim_sp = 0; sim_ep = SIM_HEIGHT - 1;
+    sim_wx = 0; sim_wy = 0;
+    sim_madctl = 0;
+    sim_pixel_format = 0;
+    sim_display_on = 0;
+    sim_tear_on = 0;
+    sim_tear_line = 0;
+    sim_tfa = 0; sim_vsa = SIM_HEIGHT;
+    sim_vsp = 0;
+    sim_rd_len = 0;
+    sim_rd_pos = 0;
+}
+
+void SIM_Reset(void)
+{
+    memset(sim_fb, 0, sizeof(sim_fb));
+    memset(&sim_count, 0, sizeof(sim_count));
+    sim_reset_registers();
+
+    // PLL and panel timing survive a soft reset on the real part, only SIM_Reset clears them
+    sim_pll_n = 0; sim_pll_m = 0;
+    sim_fpr = 0;
+    sim_ht = 0; sim_vt = 0;
+    sim_time_ns = 0;
+}
+
+// -----------------------------
+// Simulated time and scan position
+// -----------------------------
+void SIM_SetAccessNs(uint32_t ns)
+{
+    sim_access_ns = ns;
+}
+
+void SIM_SetReadNs(uint32_t ns)
+{
+    sim_read_ns = ns;
+}
+
+void SIM_AdvanceNs(uint64_t ns)
+{
+    sim_time_ns += ns;
+}
+
+uint64_t SIM_TimeNs(void)
+{
+    return sim_time_ns;
+}
+
+uint16_t SIM_Scanline(void)
+{
+    // Until the driver has programmed the timing the controller runs off whatever it
+    // powered up with; use the panel's nominal 800x480 timing rather than dividing by 0
+    const uint64_t vco_hz = (sim_pll_n && sim_pll_m)
+        ? SIM_OSC_HZ * (sim_pll_n + 1u) / (sim_pll_m + 1u) : 100000000ULL;
+    const uint64_t pclk_hz = sim_fpr ? ((vco_hz * (sim_fpr + 1u)) >> 20) : 25000000ULL;
+    const uint64_t ht = sim_ht ? sim_ht : 1056u;
+    const uint64_t vt = sim_vt ? sim_vt : 525u;
+
+    const uint64_t line_ns = (ht * 1000000000ULL) / pclk_hz;
+    return (uint16_t)((sim_time_ns / line_ns) % vt);
+}
+
+// -----------------------------
+// Command decoding
+// -----------------------------
+static uint16_t sim_be16(const uint8_t* p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+// Parameters are applied as soon as the last one a command needs has arrived
+static void sim_apply_params(void)
+{
+    switch (sim_cmd)
+    {
+    case 0x2A: // set_column_address
+        if (sim_nparams == 4) { sim_sc = sim_be16(&sim_params[0]); sim_ec = sim_be16(&sim_params[2]); }
+        break;
+    case 0x2B: // set_page_address
+        if (sim_nparams == 4) { sim_sp = sim_be16(&sim_params[0]); sim_ep = sim_be16(&sim_params[2]); }
+        break;
+    case 0x36: // set_address_mode
+        if (sim_nparams == 1) sim_madctl = sim_params[0];
+        break;
+    case 0xF0: // set_pixel_data_interface
+        if (sim_nparams == 1) sim_pixel_format = sim_params[0];
+        break;
+    case 0x35: // set_tear_on
+        if (sim_nparams == 1) sim_tear_on = (uint8_t)(1u + (sim_params[0] & 0x01));
+        break;
+    case 0x44: // set_tear_scanline
+        if (sim_nparams == 2) sim_tear_line = sim_be16(&sim_params[0]);
+        break;
+    case 0x33: // set_scroll_area (the bottom fixed area is implied)
+        if (sim_nparams == 6) { sim_tfa = sim_be16(&sim_params[0]); sim_vsa = sim_be16(&sim_params[2]); }
+        break;
+    case 0x37: // set_scroll_start
+        if (sim_nparams == 2) sim_vsp = sim_be16(&sim_params[0]);
+        break;
+    case 0xE2: // set_pll_mn
+        if (sim_nparams == 3) { sim_pll_n = sim_params[0]; sim_pll_m = sim_params[1]; }
+        break;
+    case 0xE6: // set_lshift_freq
+        if (sim_nparams == 3) sim_fpr = ((uint32_t)sim_params[0] << 16) | ((uint32_t)sim_params[1] << 8) | sim_params[2];
+        break;
+    case 0xB4: // set_hori_period
+        if (sim_nparams == 2) sim_ht = (uint16_t)(sim_be16(&sim_params[0]) + 1u);
+        break;
+    case 0xB6: // set_vert_period
+        if (sim_nparams == 2) sim_vt = (uint16_t)(sim_be16(&sim_params[0]) + 1u);
+        break;
+    default:
+        break;
+    }
+}
+
+void SIM_BusCmd(uint16_t c)
+{
+    sim_count.cmd_writes++;
+    sim_time_ns += sim_access_ns;
+
+    sim_cmd = (uint8_t)c;
+    sim_nparams = 0;
+    sim_mode = SIM_MODE_PARAM;
+
+    switch (sim_cmd)
+    {
+    case 0x01: // soft_reset
+        sim_reset_registers();
+        break;
+    case 0x28: // set_display_off
+        sim_display_on = 0;
+        break;
+    case 0x29: // set_display_on
+        sim_display_on = 1;
+        break;
+    case 0x2C: // write_memory_start
+        sim_wx = sim_sc;
+        sim_wy = sim_sp;
+        sim_mode = SIM_MODE_MEM_WRITE;
+        sim_count.windows++;
+        break;
+    case 0x3C: // write_memory_continue
+        sim_mode = SIM_MODE_MEM_WRITE;
+        break;
+    case 0x2E: // read_memory_start
+        sim_wx = sim_sc;
+        sim_wy = sim_sp;
+        sim_mode = SIM_MODE_MEM_READ;
+        break;
+    case 0x3E: // read_memory_continue
+        sim_mode = SIM_MODE_MEM_READ;
+        break;
+    case 0x34: // set_tear_off
+        sim_tear_on = 0;
+        break;
+    case 0x45: // get_scanline: latched when the command is issued
+    {
+        const uint16_t line = SIM_Scanline();
+        sim_rd[0] = (uint8_t)(line >> 8);
+        sim_rd[1] = (uint8_t)line;
+        sim_rd_len = 2;
+        sim_rd_pos = 0;
+        sim_mode = SIM_MODE_READ;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// Frame buffer index of the memory pointer, or -1 outside the panel
+static int32_t sim_pointer_index(void)
+{
+    uint16_t x = sim_wx;
+    uint16_t y = sim_wy;
+
+    if (sim_madctl & SIM_MADCTL_COL_ORDER)  x = (uint16_t)(SIM_WIDTH - 1 - x);
+    if (sim_madctl & SIM_MADCTL_PAGE_ORDER) y = (uint16_t)(SIM_HEIGHT - 1 - y);
+    if (sim_madctl & SIM_MADCTL_EXCHANGE)   { uint16_t t = x; x = y; y = t; }
+
+    return (x < SIM_WIDTH && y < SIM_HEIGHT) ? (int32_t)y * SIM_WIDTH + x : -1;
+}
+
+// Advance inside the window, wrapping columns then pages like the controller does
+static void sim_advance_pointer(void)
+{
+    if (++sim_wx > sim_ec)
+    {
+        sim_wx = sim_sc;
+        if (++sim_wy > sim_ep) sim_wy = sim_sp;
+    }
+}
+
+static void sim_store_pixel(uint16_t px)
+{
+    const int32_t i = sim_pointer_index();
+    if (i >= 0) sim_fb[i] = px;
+    sim_advance_pointer();
+}
+
+void SIM_BusData(uint16_t d)
+{
+    sim_count.data_writes++;
+    sim_time_ns += sim_access_ns;
+
+    if (sim_mode == SIM_MODE_MEM_WRITE)
+    {
+        sim_count.pixel_writes++;
+        sim_store_pixel(d);
+        return;
+    }
+
+    if (sim_nparams < SIM_MAX_PARAMS)
+    {
+        sim_params[sim_nparams++] = (uint8_t)d;
+        sim_apply_params();
+    }
+}
+
+uint16_t SIM_BusRead(void)
+{
+    sim_count.data_reads++;
+    sim_time_ns += sim_read_ns;
+
+    if (sim_mode == SIM_MODE_MEM_READ)
+    {
+        const int32_t i = sim_pointer_index();
+        sim_advance_pointer();
+        return (i >= 0) ? sim_fb[i] : 0;
+    }
+
+    if (sim_mode != SIM_MODE_READ || sim_rd_pos >= sim_rd_len) return 0;
+    return sim_rd[sim_rd_pos++];
+}
+
+// There is no concurrency on the host: the whole transfer runs before the completion
+// callback fires, which is the worst case the driver has to cope with anyway.
+HAL_StatusTypeDef SIM_DmaStart(DMA_HandleTypeDef* hdma, const uint16_t* src, uint32_t beats)
+{
+    if (beats == 0 || beats > 0xFFFFu) return HAL_ERROR;
+
+    const uint8_t inc = (hdma->Init.PeriphInc == DMA_PINC_ENABLE);
+    for (uint32_t i = 0; i < beats; i++)
+    {
+        SIM_BusData(inc ? src[i] : src[0]);
+    }
+    sim_count.dma_beats += beats;
+
+    if (hdma->XferCpltCallback) hdma->XferCpltCallback(hdma);
+    return HAL_OK;
+}
+
+// -----------------------------
+// Inspection
+// -----------------------------
+uint16_t SIM_GetPixel(uint16_t x, uint16_t y)
+{
+    if (x >= SIM_WIDTH || y >= SIM_HEIGHT) return 0;
+    return sim_fb[(uint32_t)y * SIM_WIDTH + x];
+}
+
+// Frame memory line the controller sends to panel row y
+static uint16_t sim_glass_line(uint16_t y)
+{
+    if (sim_vsa == 0 || y < sim_tfa || y >= sim_tfa + sim_vsa || sim_vsp < sim_tfa) return y;
+    return (uint16_t)(sim_tfa + (sim_vsp - sim_tfa + (y - sim_tfa)) % sim_vsa);
+}
+
+uint16_t SIM_GetScreenPixel(uint16_t x, uint16_t y)
+{
+    if (x >= SIM_WIDTH || y >= SIM_HEIGHT) return 0;
+    return sim_fb[(uint32_t)sim_glass_line(y) * SIM_WIDTH + x];
+}
+
+const uint16_t* SIM_Framebuffer(void)
+{
+    return sim_fb;
+}
+
+uint8_t SIM_DisplayOn(void)
+{
+    return sim_display_on;
+}
+
+uint8_t SIM_AddressMode(void)
+{
+    return sim_madctl;
+}
+
+uint8_t SIM_TearOn(void)
+{
+    return sim_tear_on;
+}
+
+uint16_t SIM_TearScanline(void)
+{
+    return sim_tear_line;
+}
+
+void SIM_GetCounters(SIM_BusCounters* out)
+{
+    *out = sim_count;
+}
+
+void SIM_ResetCounters(void)
+{
+    memset(&sim_count, 0, sizeof(sim_count));
+}
+
+// -----------------------------
+// Frame dumps: what the glass shows, scrolling applied
+// -----------------------------
+static void sim_rgb888(uint16_t px, uint8_t* out)
+{
+    uint8_t r = (uint8_t)((px >> 11) & 0x1F);
+    uint8_t g = (uint8_t)((px >> 5) & 0x3F);
+    uint8_t b = (uint8_t)(px & 0x1F);
+
+    r = (uint8_t)((r << 3) | (r >> 2));
+    g = (uint8_t)((g << 2) | (g >> 4));
+    b = (uint8_t)((b << 3) | (b >> 2));
+
+    // Panel wired BGR: what the glass shows has red and blue swapped
+    if (sim_madctl & SIM_MADCTL_BGR) { uint8_t t = r; r = b; b = t; }
+
+    out[0] = r; out[1] = g; out[2] = b;
+}
+
+int SIM_DumpPPM(const char* path)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", SIM_WIDTH, SIM_HEIGHT);
+
+    uint8_t row[SIM_WIDTH * 3];
+    for (uint32_t y = 0; y < SIM_HEIGHT; y++)
+    {
+        const uint16_t* line = &sim_fb[(uint32_t)sim_glass_line((uint16_t)y) * SIM_WIDTH];
+        for (uint32_t x = 0; x < SIM_WIDTH; x++) sim_rgb888(line[x], &row[x * 3]);
+        fwrite(row, 1, sizeof(row), f);
+    }
+
+    return fclose(f);
+}
+
+// Minimal PNG writer: zlib stream made of stored (uncompressed) deflate blocks,
+// so no external library is needed. Files are large but open everywhere.
+static uint32_t sim_crc_table[256];
+
+static uint32_t sim_crc32(uint32_t crc, const uint8_t* p, uint32_t n)
+{
+    if (sim_crc_table[1] == 0)
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            sim_crc_table[i] = c;
+        }
+    }
+    crc = ~crc;
+    while (n--) crc = sim_crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void sim_put_be32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24); p[1] = (uint8_t)(v >> 16); p[2] = (uint8_t)(v >> 8); p[3] = (uint8_t)v;
+}
+
+static void sim_png_chunk(FILE* f, const char* type, const uint8_t* data, uint32_t len)
+{
+    uint8_t hdr[8];
+    sim_put_be32(hdr, len);
+    memcpy(&hdr[4], type, 4);
+    fwrite(hdr, 1, 8, f);
+    if (len) fwrite(data, 1, len, f);
+
+    uint32_t crc = sim_crc32(0, (const uint8_t*)type, 4);
+    crc = sim_crc32(crc, data, len);
+    uint8_t tail[4];
+    sim_put_be32(tail, crc);
+    fwrite(tail, 1, 4, f);
+}
+
+int SIM_DumpPNG(const char* path)
+{
+    enum { ROW_BYTES = 1 + SIM_WIDTH * 3, RAW_BYTES = ROW_BYTES * SIM_HEIGHT, BLOCK = 65535 };
+    enum { NBLOCKS = (RAW_BYTES + BLOCK - 1) / BLOCK };
+    static uint8_t raw[RAW_BYTES];
+    static uint8_t zlib[2 + RAW_BYTES + NBLOCKS * 5 + 4];
+
+    // Scanlines with filter type 0
+    for (uint32_t y = 0; y < SIM_HEIGHT; y++)
+    {
+        uint8_t* row = &raw[y * ROW_BYTES];
+        const uint16_t* line = &sim_fb[(uint32_t)sim_glass_line((uint16_t)y) * SIM_WIDTH];
+        row[0] = 0;
+        for (uint32_t x = 0; x < SIM_WIDTH; x++) sim_rgb888(line[x], &row[1 + x * 3]);
+    }
+
+    uint32_t n = 0;
+    zlib[n++] = 0x78;
+    zlib[n++] = 0x01;
+    uint32_t a = 1, b = 0;
+    for (uint32_t off = 0; off < RAW_BYTES; off += BLOCK)
+    {
+        const uint32_t len = (RAW_BYTES - off < BLOCK) ? (RAW_BYTES - off) : BLOCK;
+        zlib[n++] = (off + len == RAW_BYTES) ? 1 : 0;
+        zlib[n++] = (uint8_t)len;
+        zlib[n++] = (uint8_t)(len >> 8);
+        zlib[n++] = (uint8_t)~len;
+        zlib[n++] = (uint8_t)(~len >> 8);
+        memcpy(&zlib[n], &raw[off], len);
+        n += len;
+        for (uint32_t i = 0; i < len; i++)
+        {
+            a = (a + raw[off + i]) % 65521u;
+            b = (b + a) % 65521u;
+        }
+    }
+    sim_put_be32(&zlib[n], (b << 16) | a);
+    n += 4;
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return -1;
+
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(sig, 1, sizeof(sig), f);
+
+    uint8_t ihdr[13];
+    sim_put_be32(&ihdr[0], SIM_WIDTH);
+    sim_put_be32(&ihdr[4], SIM_HEIGHT);
+    ihdr[8] = 8;    // bit depth
+    ihdr[9] = 2;    // truecolour
+    ihdr[10] = 0; ihdr[11] = 0; ihdr[12] = 0;
+    sim_png_chunk(f, "IHDR", ihdr, sizeof(ihdr));
+    sim_png_chunk(f, "IDAT", zlib, n);
+    sim_png_chunk(f, "IEND", NULL, 0);
+
+    return fclose(f);
+}
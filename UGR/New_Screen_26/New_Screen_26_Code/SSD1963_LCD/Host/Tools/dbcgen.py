@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""Generate the CAN signal decode tables for can_signal.c from a DBC file.
+
+    python3 Host/Tools/dbcgen.py Assets/ecu.dbc -o build/candb
+
+Writes can_db.h (message and signal ids, counts) and can_db.c (cansig_messages,
+cansig_defs). cmake/candb.cmake runs this as a build step, so the tables always match
+the DBC the firmware is built against.
+
+Every signal is reduced to a shift and a length on one 64-bit word holding the frame's
+data bytes: the little-endian word for Intel (@1) signals, the byte-swapped word for
+Motorola (@0) ones. The decoder then never walks bits. Messages are sorted by
+identifier (extended ones after standard) for a binary search, and each message's
+signals are contiguous, so decoding a frame writes one run of the signal store.
+
+Multiplexed signals, float signals (SIG_VALTYPE_) and signals wider than 32 bits are
+rejected; none of them are on the car's bus.
+"""
+import argparse
+import os
+import re
+import sys
+
+CAN_EXT_FLAG = 0x80000000   # DBC marks 29-bit identifiers with bit 31
+
+BO_RE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)")
+SG_RE = re.compile(r"^SG_\s+(\w+)\s*(M|m\d+)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+                   r"\(\s*([^,\s]+)\s*,\s*([^)\s]+)\s*\)\s*\[([^|\]]*)\|([^\]]*)\]\s*\"([^\"]*)\"")
+VALTYPE_RE = re.compile(r"^SIG_VALTYPE_\s+(\d+)\s+(\w+)\s*:\s*(\d)")
+
+
+# -----------------------------
+# Parsing
+# -----------------------------
+class Signal:
+    def __init__(self, name, start, length, motorola, signed, scale, offset, unit):
+        self.name, self.start, self.length = name, start, length
+        self.motorola, self.signed = motorola, signed
+        self.scale, self.offset, self.unit = scale, offset, unit
+        self.text = ""  # as written, for the generated comments
+
+    def bits(self):
+        """Physical bits (byte * 8 + bit in byte) the signal covers, MSB first for Motorola."""
+        if not self.motorola:
+            return [self.start + i for i in range(self.length)]
+        out, bit = [], self.start
+        for _ in range(self.length):
+            out.append(bit)
+            bit = bit + 15 if bit % 8 == 0 else bit - 1
+        return out
+
+    def shift(self):
+        if not self.motorola:
+            return self.start
+        # Bit 0 of the swapped word is bit 0 of byte 7; count down from the first byte's MSB
+        msb = (self.start // 8) * 8 + 7 - self.start % 8
+        return 63 - (msb + self.length - 1)
+
+
+class Message:
+    def __init__(self, raw_id, name, dlc):
+        self.ext = bool(raw_id & CAN_EXT_FLAG)
+        self.id = raw_id & 0x1FFFFFFF
+        self.name, self.dlc, self.signals = name, dlc, []
+
+    def key(self):
+        return self.id | (CAN_EXT_FLAG if self.ext else 0)
+
+
+def fail(path, line, msg):
+    raise SystemExit("%s:%d: %s" % (path, line, msg))
+
+
+def parse(path):
+    messages, msg = [], None
+    with open(path, encoding="latin-1") as f:
+        for n, line in enumerate(f, 1):
+            text = line.strip()
+            m = BO_RE.match(text)
+            if m:
+                raw_id = int(m.group(1))
+                msg = Message(raw_id, m.group(2), int(m.group(3)))
+                if msg.dlc > 8:
+                    fail(path, n, "%s: CAN FD lengths are not supported" % msg.name)
+                if not msg.ext and msg.id > 0x7FF:
+                    fail(path, n, "%s: standard identifier 0x%X out of range" % (msg.name, msg.id))
+                if raw_id == 0xC0000000:
+                    msg = None  # VECTOR__INDEPENDENT_SIG_MSG: signals without a message
+                else:
+                    messages.append(msg)
+                continue
+
+            if text.startswith("SG_"):
+                m = SG_RE.match(text)
+                if not m:
+                    fail(path, n, "cannot parse signal: %s" % text)
+                if msg is None:
+                    continue
+                if m.group(2):
+                    fail(path, n, "%s: multiplexed signals are not supported" % m.group(1))
+                sig = Signal(m.group(1), int(m.group(3)), int(m.group(4)), m.group(5) == "0",
+                             m.group(6) == "-", float(m.group(7)), float(m.group(8)), m.group(11))
+                sig.text = "%s|%s@%s%s (%s,%s)" % (m.group(3), m.group(4), m.group(5), m.group(6),
+                                                   m.group(7), m.group(8))
+                if not 1 <= sig.length <= 32:
+                    fail(path, n, "%s: length %d, 1 to 32 bits supported" % (sig.name, sig.length))
+                if any(b < 0 or b >= msg.dlc * 8 for b in sig.bits()):
+                    fail(path, n, "%s: does not fit in the %d bytes of %s" % (sig.name, msg.dlc, msg.name))
+                msg.signals.append(sig)
+                continue
+
+            # Anything else ends the current message's signal list
+            msg = None
+            m = VALTYPE_RE.match(text)
+            if m and m.group(3) != "0":
+                fail(path, n, "%s: float signals are not supported" % m.group(2))
+
+    return messages
+
+
+def check(messages):
+    keys, names = set(), set()
+    for msg in messages:
+        if msg.key() in keys:
+            raise SystemExit("duplicate identifier 0x%X (%s)" % (msg.id, msg.name))
+        keys.add(msg.key())
+        used = set()
+        for sig in msg.signals:
+            bits = set(sig.bits())
+            if bits & used:
+                raise SystemExit("%s.%s overlaps another signal" % (msg.name, sig.name))
+            used |= bits
+            if sig.name in names:
+                raise SystemExit("signal name %s is used twice" % sig.name)
+            names.add(sig.name)
+
+
+# -----------------------------
+# Output
+# -----------------------------
+def c_name(name):
+    return re.sub(r"(?<=[a-z0-9])(?=[A-Z])", "_", name).upper()
+
+
+def c_float(v):
+    s = "%.9g" % v
+    if "." not in s and "e" not in s:
+        s += ".0"
+    return s + "f"
+
+
+def emit(messages, src):
+    nsig = sum(len(m.signals) for m in messages)
+    head = "// Generated by Host/Tools/dbcgen.py from %s, do not edit.\n" % src
+
+    h = [head, "// %d messages, %d signals\n" % (len(messages), nsig), "#pragma once\n\n"]
+    h.append("#define CANDB_MESSAGE_COUNT     %d\n" % len(messages))
+    h.append("#define CANDB_SIGNAL_COUNT      %d\n\n" % nsig)
+    h.append("// Messages in identifier order (cansig_messages)\ntypedef enum\n{\n")
+    for msg in messages:
+        h.append("    %-32s// 0x%X%s\n" % ("CANMSG_%s," % c_name(msg.name), msg.id, " ext" if msg.ext else ""))
+    h.append("} CANMSG_Id;\n\n")
+    h.append("// Signals, message by message (cansig_defs, cansig_store.value)\ntypedef enum\n{\n")
+    for msg in messages:
+        for sig in msg.signals:
+            h.append("    %-32s// %s %s%s\n" % ("CANSIG_%s," % c_name(sig.name), msg.name, sig.text,
+                                               (" " + sig.unit) if sig.unit else ""))
+    h.append("} CANSIG_Id;\n")
+
+    c = [head, '#include "can_signal.h"\n\n']
+    c.append("const CANSIG_Message cansig_messages[CANDB_MESSAGE_COUNT] = {\n")
+    first = 0
+    for msg in messages:
+        flags = "CANSIG_MOTOROLA" if any(s.motorola for s in msg.signals) else "0"
+        key = "0x%Xu" % msg.id + (" | CANSIG_KEY_EXT" if msg.ext else "")
+        c.append("    { %s, %d, %d, %d, %s },   // %s\n" % (key, first, msg.dlc, len(msg.signals), flags, msg.name))
+        first += len(msg.signals)
+    c.append("};\n\n")
+    c.append("const CANSIG_Def cansig_defs[CANDB_SIGNAL_COUNT] = {\n")
+    for msg in messages:
+        for sig in msg.signals:
+            flags = " | ".join(f for f, on in (("CANSIG_SIGNED", sig.signed), ("CANSIG_MOTOROLA", sig.motorola)) if on)
+            c.append("    { %s, %s, %d, %d, %s, %d },   // %s\n" % (c_float(sig.scale), c_float(sig.offset),
+                     sig.shift(), sig.length, flags or "0", sig.start, sig.name))
+    c.append("};\n")
+    return "".join(h), "".join(c)
+
+
+def write_if_changed(path, text):
+    # Unchanged tables keep their timestamps, so a DBC comment edit rebuilds nothing
+    try:
+        with open(path, newline="\n") as f:
+            if f.read() == text:
+                return
+    except FileNotFoundError:
+        pass
+    with open(path, "w", newline="\n") as f:
+        f.write(text)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("dbc")
+    ap.add_argument("-o", "--output", required=True, help="directory for can_db.h and can_db.c")
+    args = ap.parse_args()
+
+    messages = [m for m in parse(args.dbc) if m.signals]
+    messages.sort(key=Message.key)
+    check(messages)
+    if len(messages) > 255 or sum(len(m.signals) for m in messages) > 0xFFFF:
+        raise SystemExit("too many messages or signals for the table format")
+
+    header, source = emit(messages, os.path.basename(args.dbc))
+    os.makedirs(args.output, exist_ok=True)
+    write_if_changed(os.path.join(args.output, "can_db.h"), header)
+    write_if_changed(os.path.join(args.output, "can_db.c"), source)
+
+    print("%s: %d messages, %d signals" % (args.dbc, len(messages), sum(len(m.signals) for m in messages)),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,397 @@
+#!/usr/bin/env python3
+"""Rasterise a TrueType font into packed anti-aliased glyph tables for ssd1963_font.c.
+
+Pure Python (no freetype/PIL): parses cmap/glyf/hmtx, flattens the quadratic outlines
+and computes exact horizontal span coverage over SUBSAMPLES sub-scanlines per pixel.
+
+    python3 Host/Tools/fontgen.py Lato-Regular.ttf 16 --bpp 4 --name lato16 \\
+        -o Core/Src/font_lato16.c
+
+Glyph bitmaps are packed MSB first, row-major without row padding; every glyph starts
+on a byte boundary. Coverage 0 is background, (1 << bpp) - 1 is full foreground.
+"""
+import argparse
+import math
+import os
+import struct
+import sys
+
+SUBSAMPLES = 16     # sub-scanlines per pixel row
+CURVE_STEPS = 8     # line segments per quadratic Bezier
+
+
+# -----------------------------
+# TrueType parsing
+# -----------------------------
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        num_tables = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, off, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (off, length)
+
+        head = self.tables["head"][0]
+        self.units_per_em = struct.unpack_from(">H", self.data, head + 18)[0]
+        self.loca_long = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+
+        self.num_glyphs = struct.unpack_from(">H", self.data, self.tables["maxp"][0] + 4)[0]
+
+        hhea = self.tables["hhea"][0]
+        self.ascender, self.descender, self.line_gap = struct.unpack_from(">hhh", self.data, hhea + 4)
+        self.num_hmetrics = struct.unpack_from(">H", self.data, hhea + 34)[0]
+
+        self.cmap = self._parse_cmap()
+
+    def _parse_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        chosen = None
+        for i in range(count):
+            platform, encoding, off = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            fmt = struct.unpack_from(">H", self.data, base + off)[0]
+            if fmt == 4 and (platform, encoding) in ((3, 1), (0, 3), (0, 4), (0, 1), (0, 0)):
+                chosen = base + off
+                if platform == 3:
+                    break
+        if chosen is None:
+            raise SystemExit("no cmap format 4 subtable")
+
+        seg_x2 = struct.unpack_from(">H", self.data, chosen + 6)[0]
+        segs = seg_x2 // 2
+        ends = struct.unpack_from(">%dH" % segs, self.data, chosen + 14)
+        starts = struct.unpack_from(">%dH" % segs, self.data, chosen + 16 + seg_x2)
+        deltas = struct.unpack_from(">%dh" % segs, self.data, chosen + 16 + 2 * seg_x2)
+        range_base = chosen + 16 + 3 * seg_x2
+        ranges = struct.unpack_from(">%dH" % segs, self.data, range_base)
+
+        cmap = {}
+        for s in range(segs):
+            for c in range(starts[s], ends[s] + 1):
+                if c == 0xFFFF:
+                    continue
+                if ranges[s] == 0:
+                    g = (c + deltas[s]) & 0xFFFF
+                else:
+                    addr = range_base + 2 * s + ranges[s] + 2 * (c - starts[s])
+                    g = struct.unpack_from(">H", self.data, addr)[0]
+                    if g:
+                        g = (g + deltas[s]) & 0xFFFF
+                if g:
+                    cmap[c] = g
+        return cmap
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        i = min(glyph, self.num_hmetrics - 1)
+        return struct.unpack_from(">H", self.data, hmtx + 4 * i)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.loca_long:
+            a, b = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            a, b = struct.unpack_from(">HH", self.data, loca + 2 * glyph)
+            a, b = 2 * a, 2 * b
+        return a, b
+
+    def contours(self, glyph, depth=0):
+        """List of closed contours, each a list of (x, y, on_curve) in font units."""
+        start, end = self._glyph_range(glyph)
+        if start == end:
+            return []
+        p = self.tables["glyf"][0] + start
+        n = struct.unpack_from(">h", self.data, p)[0]
+        if n >= 0:
+            return self._simple(p, n)
+        if depth > 8:
+            return []
+        return self._composite(p, depth)
+
+    def _simple(self, p, n):
+        d = self.data
+        end_pts = struct.unpack_from(">%dH" % n, d, p + 10)
+        npts = end_pts[-1] + 1 if n else 0
+        q = p + 10 + 2 * n
+        q += 2 + struct.unpack_from(">H", d, q)[0]
+
+        flags = []
+        while len(flags) < npts:
+            f = d[q]
+            q += 1
+            flags.append(f)
+            if f & 8:
+                r = d[q]
+                q += 1
+                flags.extend([f] * r)
+
+        def coords(short_bit, same_bit):
+            nonlocal q
+            out, v = [], 0
+            for f in flags:
+                if f & short_bit:
+                    delta = d[q]
+                    q += 1
+                    v += delta if f & same_bit else -delta
+                elif not (f & same_bit):
+                    v += struct.unpack_from(">h", d, q)[0]
+                    q += 2
+                out.append(v)
+            return out
+
+        xs = coords(0x02, 0x10)
+        ys = coords(0x04, 0x20)
+
+        contours, first = [], 0
+        for e in end_pts:
+            contours.append([(xs[i], ys[i], bool(flags[i] & 1)) for i in range(first, e + 1)])
+            first = e + 1
+        return contours
+
+    def _composite(self, p, depth):
+        d = self.data
+        q = p + 10
+        out = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", d, q)
+            q += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from(">hh", d, q)
+                q += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", d, q)
+                q += 2
+            a, b, c, e = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                a = e = struct.unpack_from(">h", d, q)[0] / 16384.0
+                q += 2
+            elif flags & 0x0040:
+                a, e = (v / 16384.0 for v in struct.unpack_from(">hh", d, q))
+                q += 4
+            elif flags & 0x0080:
+                a, b, c, e = (v / 16384.0 for v in struct.unpack_from(">hhhh", d, q))
+                q += 8
+            if not (flags & 0x0002):
+                dx = dy = 0     # point matching is not supported; ASCII glyphs do not use it
+            for contour in self.contours(glyph, depth + 1):
+                out.append([(a * x + c * y + dx, b * x + e * y + dy, on) for x, y, on in contour])
+            if not (flags & 0x0020):
+                break
+        return out
+
+
+# -----------------------------
+# Rasteriser
+# -----------------------------
+def flatten(contour, scale):
+    """Closed polyline in pixel units (y down, origin at the baseline)."""
+    pts = [(x * scale, -y * scale, on) for x, y, on in contour]
+    n = len(pts)
+    if n == 0:
+        return []
+
+    # Start on an on-curve point (or the midpoint of two off-curve ones)
+    start = next((i for i in range(n) if pts[i][2]), None)
+    if start is None:
+        a, b = pts[0], pts[1 % n]
+        first = ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2)
+        order = pts[1:] + pts[:1]
+    else:
+        first = pts[start][:2]
+        order = pts[start + 1:] + pts[:start + 1]
+
+    poly = [first]
+    cur = first
+    ctrl = None
+    for x, y, on in order:
+        if on:
+            if ctrl is None:
+                poly.append((x, y))
+            else:
+                poly.extend(quad(cur, ctrl, (x, y)))
+                ctrl = None
+            cur = (x, y)
+        else:
+            if ctrl is not None:
+                mid = ((ctrl[0] + x) / 2, (ctrl[1] + y) / 2)
+                poly.extend(quad(cur, ctrl, mid))
+                cur = mid
+            ctrl = (x, y)
+    if ctrl is not None:
+        poly.extend(quad(cur, ctrl, first))
+    return poly
+
+
+def quad(p0, p1, p2):
+    out = []
+    for i in range(1, CURVE_STEPS + 1):
+        t = i / CURVE_STEPS
+        u = 1 - t
+        out.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                    u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return out
+
+
+def rasterise(polys, x0, y0, w, h):
+    """Coverage 0..1 per pixel of the w*h box whose top-left is (x0, y0), non-zero rule."""
+    edges = []
+    for poly in polys:
+        for i in range(len(poly)):
+            (ax, ay), (bx, by) = poly[i], poly[(i + 1) % len(poly)]
+            if ay == by:
+                continue
+            wind = 1 if by > ay else -1
+            if ay > by:
+                ax, ay, bx, by = bx, by, ax, ay
+            edges.append((ay, by, ax, (bx - ax) / (by - ay), wind))
+
+    cov = [[0.0] * w for _ in range(h)]
+    for row in range(h):
+        line = cov[row]
+        for s in range(SUBSAMPLES):
+            sy = y0 + row + (s + 0.5) / SUBSAMPLES
+            xs = [(ax + (sy - ay) * slope, wind) for ay, by, ax, slope, wind in edges if ay <= sy < by]
+            if not xs:
+                continue
+            xs.sort()
+            winding = 0
+            for i in range(len(xs) - 1):
+                winding += xs[i][1]
+                if winding == 0:
+                    continue
+                a = xs[i][0] - x0
+                b = xs[i + 1][0] - x0
+                add_span(line, a, b, 1.0 / SUBSAMPLES)
+    return cov
+
+
+def add_span(line, a, b, weight):
+    if b <= 0 or a >= len(line) or b <= a:
+        return
+    a = max(a, 0.0)
+    b = min(b, float(len(line)))
+    ia, ib = int(a), int(math.ceil(b)) - 1
+    if ia == ib:
+        line[ia] += (b - a) * weight
+        return
+    line[ia] += (ia + 1 - a) * weight
+    for x in range(ia + 1, ib):
+        line[x] += weight
+    line[ib] += (b - ib) * weight
+
+
+# -----------------------------
+# Output
+# -----------------------------
+def pack(levels, bpp):
+    out, acc, nbits = bytearray(), 0, 0
+    for v in levels:
+        acc = (acc << bpp) | v
+        nbits += bpp
+        if nbits == 8:
+            out.append(acc)
+            acc, nbits = 0, 0
+    if nbits:
+        out.append(acc << (8 - nbits))
+    return out
+
+
+def char_comment(c):
+    ch = chr(c)
+    if ch == "\\":
+        return "'\\\\'"
+    return "'%s'" % ch
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("ttf")
+    ap.add_argument("size", type=int, help="em size in pixels")
+    ap.add_argument("--bpp", type=int, choices=(1, 2, 4), default=4)
+    ap.add_argument("--name", required=True, help="C identifier suffix: font_<name>")
+    ap.add_argument("--chars", help="characters to include (default printable ASCII)")
+    ap.add_argument("--gamma", type=float, default=1.0, help="coverage exponent (<1 thickens strokes)")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    font = TrueType(args.ttf)
+    scale = args.size / font.units_per_em
+    codes = sorted(set(ord(c) for c in args.chars)) if args.chars else list(range(32, 127))
+    if not codes or codes[0] < 32 or codes[-1] > 126:
+        raise SystemExit("only printable ASCII is supported")
+
+    ascent = int(math.ceil(font.ascender * scale))
+    descent = int(math.ceil(-font.descender * scale))
+    line_height = ascent + descent
+    maxv = (1 << args.bpp) - 1
+
+    bitmap = bytearray()
+    glyphs = []
+    for c in range(codes[0], codes[-1] + 1):
+        g = font.cmap.get(c)
+        if c not in codes or g is None:
+            glyphs.append((c, 0, 0, 0, 0, 0, 0, False))
+            continue
+
+        adv = int(round(font.advance(g) * scale))
+        polys = [flatten(ct, scale) for ct in font.contours(g)]
+        pts = [p for poly in polys for p in poly]
+        if not pts:
+            glyphs.append((c, len(bitmap), 0, 0, 0, 0, adv, True))
+            continue
+
+        bx0 = int(math.floor(min(p[0] for p in pts)))
+        bx1 = int(math.ceil(max(p[0] for p in pts)))
+        by0 = int(math.floor(min(p[1] for p in pts)))
+        by1 = int(math.ceil(max(p[1] for p in pts)))
+        w, h = bx1 - bx0, by1 - by0
+        if w > 255 or h > 255:
+            raise SystemExit("glyph %r larger than 255 px" % chr(c))
+
+        cov = rasterise(polys, bx0, by0, w, h)
+        levels = [min(maxv, int(round(min(1.0, v) ** args.gamma * maxv))) for row in cov for v in row]
+        glyphs.append((c, len(bitmap), w, h, bx0, by0, adv, True))
+        bitmap += pack(levels, args.bpp)
+
+    if len(bitmap) > 0xFFFFFFFF:
+        raise SystemExit("bitmap too large")
+
+    name = args.name
+    src = os.path.basename(args.ttf)
+    with open(args.output, "w", newline="\n") as f:
+        f.write("// Generated by Host/Tools/fontgen.py from %s, do not edit.\n" % src)
+        f.write("//   fontgen.py %s %d --bpp %d --name %s%s%s\n" % (
+            src, args.size, args.bpp, name,
+            (" --chars '%s'" % args.chars) if args.chars else "",
+            (" --gamma %g" % args.gamma) if args.gamma != 1.0 else ""))
+        f.write("// %d glyphs, %d bitmap bytes, line height %d px\n" % (sum(1 for g in glyphs if g[7]), len(bitmap), line_height))
+        f.write('#include "ssd1963_font.h"\n\n')
+
+        f.write("static const uint8_t %s_bitmap[] = {\n" % name)
+        for i in range(0, len(bitmap), 16):
+            f.write("    " + ", ".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",\n")
+        if not bitmap:
+            f.write("    0x00\n")
+        f.write("};\n\n")
+
+        f.write("static const SSD1963_Glyph %s_glyphs[] = {\n" % name)
+        f.write("    // offset, w, h, x_off, y_off, advance\n")
+        for c, off, w, h, xo, yo, adv, present in glyphs:
+            f.write("    { %6d, %3d, %3d, %4d, %4d, %3d },  // %s%s\n" % (
+                off, w, h, xo, yo, adv, char_comment(c), "" if present else " (absent)"))
+        f.write("};\n\n")
+
+        f.write("const SSD1963_Font font_%s = {\n" % name)
+        f.write("    %s_bitmap,\n    %s_glyphs,\n" % (name, name))
+        f.write("    %d, %d,  // first, last\n" % (codes[0], codes[-1]))
+        f.write("    %d,  // bpp\n" % args.bpp)
+        f.write("    %d, %d  // line height, ascent\n" % (line_height, ascent))
+        f.write("};\n")
+
+    print("%s: %d glyphs, %d bytes" % (args.output, sum(1 for g in glyphs if g[7]), len(bitmap)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
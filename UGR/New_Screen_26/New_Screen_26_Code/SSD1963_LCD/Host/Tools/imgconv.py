@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Convert a PNG or PPM image into a compressed RGB565 asset for ssd1963_image.c.
+
+    python3 Host/Tools/imgconv.py Assets/dash_bg.png --name dash_bg -o Core/Src/img_dash_bg.c
+
+Stream format (see ssd1963_image.h): a sequence of ops, each one tag byte
+    tt nnnnnn   tt = op, nnnnnn = count - 1 (0..62), 63 = 64 + LEB128 count that follows
+    00 RUN      repeat the last colour
+    01 LITERAL  count colours follow, little-endian RGB565
+    10 FILL     one colour follows (becomes the last colour), then repeat it
+    11 ABOVE    copy from the row above (black above row 0)
+Ops run across row ends; the image is walked row-major. Alpha is composited over --bg.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+OP_RUN, OP_LITERAL, OP_FILL, OP_ABOVE = 0, 1, 2, 3
+
+
+# -----------------------------
+# Input
+# -----------------------------
+def read_ppm(data):
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise SystemExit("only binary 8-bit PPM (P6) is supported")
+    w, h = int(fields[1]), int(fields[2])
+    px = data[pos + 1:pos + 1 + w * h * 3]
+    return w, h, [(px[i], px[i + 1], px[i + 2], 255) for i in range(0, w * h * 3, 3)]
+
+
+def read_png(data):
+    pos, idat = 8, b""
+    while pos < len(data):
+        length, tag = struct.unpack_from(">I4s", data, pos)
+        body = data[pos + 8:pos + 8 + length]
+        if tag == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif tag == b"IDAT":
+            idat += body
+        pos += 12 + length
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or channels is None or interlace:
+        raise SystemExit("only 8-bit non-interlaced grey/RGB/RGBA PNG is supported")
+
+    raw = zlib.decompress(idat)
+    stride = w * channels
+    prev = bytearray(stride)
+    rows, pos = [], 0
+    for _ in range(h):
+        f = raw[pos]
+        line = bytearray(raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if f == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif f == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif f == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif f == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    px = []
+    for line in rows:
+        for i in range(0, stride, channels):
+            if channels == 1:
+                px.append((line[i], line[i], line[i], 255))
+            elif channels == 2:
+                px.append((line[i], line[i], line[i], line[i + 1]))
+            elif channels == 3:
+                px.append((line[i], line[i + 1], line[i + 2], 255))
+            else:
+                px.append(tuple(line[i:i + 4]))
+    return w, h, px
+
+
+def to_rgb565(px, bg):
+    out = []
+    for r, g, b, a in px:
+        r = (r * a + bg[0] * (255 - a) + 127) // 255
+        g = (g * a + bg[1] * (255 - a) + 127) // 255
+        b = (b * a + bg[2] * (255 - a) + 127) // 255
+        out.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return out
+
+
+# -----------------------------
+# Encoder
+# -----------------------------
+def tag(op, count):
+    if count <= 63:
+        return bytes([(op << 6) | (count - 1)])
+    out = bytearray([(op << 6) | 63])
+    v = count - 64
+    while True:
+        byte = v & 0x7F
+        v >>= 7
+        out.append(byte | (0x80 if v else 0))
+        if not v:
+            return bytes(out)
+
+
+def encode(pix, w):
+    n = len(pix)
+
+    # Length of the stretch starting at i that equals pix[i], and that equals the row above
+    same = [1] * n
+    for i in range(n - 2, -1, -1):
+        if pix[i + 1] == pix[i]:
+            same[i] = same[i + 1] + 1
+    above = [0] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        if pix[i] == (pix[i - w] if i >= w else 0):
+            above[i] = above[i + 1] + 1
+
+    out = bytearray()
+    literal = []
+    last = 0
+
+    def flush_literal():
+        for k in range(0, len(literal), 4096):
+            chunk = literal[k:k + 4096]
+            out.extend(tag(OP_LITERAL, len(chunk)))
+            for c in chunk:
+                out.extend(struct.pack("<H", c))
+        literal.clear()
+
+    i = 0
+    while i < n:
+        run = same[i] if pix[i] == last else 0
+        fill = same[i]
+        copy = above[i]
+
+        # Cheapest op per pixel covered; a fill costs two colour bytes more
+        if run >= 2 and run >= copy and run >= fill:
+            op, count = OP_RUN, run
+        elif copy >= 2 and copy >= fill:
+            op, count = OP_ABOVE, copy
+        elif fill >= 3:
+            op, count = OP_FILL, fill
+        else:
+            literal.append(pix[i])
+            last = pix[i]
+            i += 1
+            continue
+
+        flush_literal()
+        out.extend(tag(op, count))
+        if op == OP_FILL:
+            out.extend(struct.pack("<H", pix[i]))
+        last = pix[i + count - 1]
+        i += count
+    flush_literal()
+    return bytes(out)
+
+
+def decode(data, w, h):
+    """Reference decoder, used to verify every asset before it is written."""
+    row = [0] * w
+    out = []
+    pos, x, last = 0, 0, 0
+    while len(out) < w * h:
+        t = data[pos]
+        pos += 1
+        op, count = t >> 6, (t & 63) + 1
+        if count == 64:
+            v, shift = 0, 0
+            while True:
+                b = data[pos]
+                pos += 1
+                v |= (b & 0x7F) << shift
+                shift += 7
+                if not b & 0x80:
+                    break
+            count = 64 + v
+        if op == OP_FILL:
+            last = struct.unpack_from("<H", data, pos)[0]
+            pos += 2
+        for _ in range(count):
+            if op == OP_LITERAL:
+                last = struct.unpack_from("<H", data, pos)[0]
+                pos += 2
+            elif op == OP_ABOVE:
+                last = row[x]
+            row[x] = last
+            out.append(last)
+            x = (x + 1) % w
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("image", help="PNG or binary PPM")
+    ap.add_argument("--name", required=True, help="C identifier suffix: img_<name>")
+    ap.add_argument("--bg", default="000000", help="hex RGB that alpha is composited over")
+    ap.add_argument("-o", "--output", required=True)
+    args = ap.parse_args()
+
+    with open(args.image, "rb") as f:
+        data = f.read()
+    if data[:8] == b"\x89PNG\r\n\x1a\n":
+        w, h, px = read_png(data)
+    else:
+        w, h, px = read_ppm(data)
+    if w > 0xFFFF or h > 0xFFFF:
+        raise SystemExit("image too large")
+
+    bg = tuple(int(args.bg[i:i + 2], 16) for i in (0, 2, 4))
+    pix = to_rgb565(px, bg)
+    stream = encode(pix, w)
+    if decode(stream, w, h) != pix:
+        raise SystemExit("encoder self-check failed")
+
+    name = args.name
+    src = os.path.basename(args.image)
+    raw = w * h * 2
+    with open(args.output, "w", newline="\n") as f:
+        f.write("// Generated by Host/Tools/imgconv.py from %s, do not edit.\n" % src)
+        f.write("//   imgconv.py %s --name %s%s\n" % (src, name, (" --bg %s" % args.bg) if args.bg != "000000" else ""))
+        f.write("// %dx%d, %d bytes (raw RGB565 %d bytes, %.1f%%)\n" % (w, h, len(stream), raw, 100.0 * len(stream) / raw))
+        f.write('#include "ssd1963_image.h"\n\n')
+        f.write("static const uint8_t %s_data[] = {\n" % name)
+        for i in range(0, len(stream), 16):
+            f.write("    " + ", ".join("0x%02X" % b for b in stream[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write("const SSD1963_Image img_%s = { %d, %d, sizeof(%s_data), %s_data };\n" % (name, w, h, name, name))
+
+    print("%s: %dx%d, %d -> %d bytes (%.1f%%)" % (args.output, w, h, raw, len(stream), 100.0 * len(stream) / raw),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,24 @@
+#
+# CAN signal tables (can_signal.h), generated from a DBC file at build time by
+# Host/Tools/dbcgen.py. Shared by the firmware and the host build.
+#
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+get_filename_component(CANDB_FW_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+set(CAN_DBC "${CANDB_FW_DIR}/Assets/ecu.dbc" CACHE FILEPATH "DBC file the CAN decode tables are generated from")
+set(CANDB_TOOL "${CANDB_FW_DIR}/Host/Tools/dbcgen.py")
+
+# Adds the generated can_db.c to target and its directory to the include path
+function(candb_generate target)
+    set(out "${CMAKE_CURRENT_BINARY_DIR}/candb")
+    add_custom_command(
+        OUTPUT "${out}/can_db.h" "${out}/can_db.c"
+        COMMAND Python3::Interpreter "${CANDB_TOOL}" "${CAN_DBC}" -o "${out}"
+        DEPENDS "${CANDB_TOOL}" "${CAN_DBC}"
+        COMMENT "Generating CAN decode tables from ${CAN_DBC}"
+        VERBATIM
+    )
+    target_sources(${target} PRIVATE "${out}/can_db.c" "${out}/can_db.h")
+    target_include_directories(${target} PUBLIC "${out}")
+endfunction()